@@ -54,9 +54,13 @@ Bridge::Bridge(Bridge&& other) noexcept
     , config_(other.config_)
     , display_(other.display_)
     , initialized_(other.initialized_)
+    , frame_hooks_(other.frame_hooks_)
 #if OC_ENABLE_STATS
     , refresh_diagnostics_(other.refresh_diagnostics_)
 #endif
+#if OC_UI_LVGL_STATIC_SURFACE_VALIDATION
+    , validation_frame_(other.validation_frame_)
+#endif
 {
     if (display_) lv_display_set_user_data(display_, this);
     other.display_ = nullptr;
@@ -75,8 +79,12 @@ Bridge& Bridge::operator=(Bridge&& other) noexcept {
         config_ = other.config_;
         display_ = other.display_;
         initialized_ = other.initialized_;
+        frame_hooks_ = other.frame_hooks_;
 #if OC_ENABLE_STATS
         refresh_diagnostics_ = other.refresh_diagnostics_;
+#endif
+#if OC_UI_LVGL_STATIC_SURFACE_VALIDATION
+        validation_frame_ = other.validation_frame_;
 #endif
         if (display_) lv_display_set_user_data(display_, this);
         other.display_ = nullptr;
@@ -95,9 +103,25 @@ oc::type::Result<void> Bridge::init() {
     if (!buffer_) return R::err({E::INVALID_ARGUMENT, "buffer required"});
     if (!timeProvider_) return R::err({E::INVALID_ARGUMENT, "time provider required"});
 
+    if (config_.heapRegions) {
+        switch (heap::installRegions(config_.heapRegions, config_.heapRegionCount)) {
+            case heap::InstallResult::Ok:
+                break;
+            case heap::InstallResult::NoAllocatorHooks:
+                return R::err({E::INVALID_ARGUMENT, "heap regions need OC_LVGL_CUSTOM_HEAP"});
+            case heap::InstallResult::InvalidTable:
+                return R::err({E::INVALID_ARGUMENT, "heap region table invalid"});
+            case heap::InstallResult::RegionsInUse:
+                return R::err({E::INVALID_ARGUMENT, "heap regions still hold live blocks"});
+        }
+    }
+
     // Initialize LVGL (idempotent - safe to call multiple times)
     lv_init();
 
+    // Tag draw layers and glyph buffers once LVGL has set up its handlers
+    if (heap::regionCount() > 0) (void)heap::installDrawBufferHandlers();
+
     // Set tick callback for LVGL timing
     lv_tick_set_cb(timeProvider_);
 
@@ -132,10 +156,7 @@ oc::type::Result<void> Bridge::init() {
 
     // Configure refresh rate if specified
     if (config_.refreshHz > 0) {
-        lv_timer_set_period(
-            lv_display_get_refr_timer(display_),
-            std::max<uint32_t>(1U, 1000U / config_.refreshHz)
-        );
+        lv_timer_set_period(lv_display_get_refr_timer(display_), refreshPeriodMs());
     }
 
     // Set screen background color
@@ -147,6 +168,9 @@ oc::type::Result<void> Bridge::init() {
 
 void Bridge::refresh() {
     if (initialized_) {
+        for (const auto& hook : frame_hooks_) {
+            if (hook.fn) hook.fn(hook.userData);
+        }
 #if OC_ENABLE_STATS
         refresh_diagnostics_.invalidatedPixels =
             refresh_diagnostics_.pendingInvalidatedPixels;
@@ -163,10 +187,58 @@ void Bridge::refresh() {
             refresh_diagnostics_.invalidatedPixels,
             refresh_diagnostics_.submittedPixels
         );
+#endif
+#if OC_UI_LVGL_STATIC_SURFACE_VALIDATION
+        if (validation_frame_) {
+            const auto stride = static_cast<uint32_t>(lv_display_get_horizontal_resolution(display_))
+                * lv_color_format_get_size(DISPLAY_COLOR_FORMAT);
+            (void)verifyStaticSurfaceFrame(display_, validation_frame_, stride);
+            validation_frame_ = nullptr;
+        }
 #endif
     }
 }
 
+uint32_t Bridge::refreshPeriodMs() const {
+    if (config_.refreshHz == 0) return LV_DEF_REFR_PERIOD;
+    return std::max<uint32_t>(1U, 1000U / config_.refreshHz);
+}
+
+bool Bridge::addFrameHook(FrameHookFn fn, void* userData) {
+    if (!fn) return false;
+    for (auto& hook : frame_hooks_) {
+        if (hook.fn == fn && hook.userData == userData) return true;
+    }
+    for (auto& hook : frame_hooks_) {
+        if (hook.fn) continue;
+        hook = FrameHook{fn, userData};
+        return true;
+    }
+    return false;
+}
+
+void Bridge::removeFrameHook(FrameHookFn fn, void* userData) {
+    for (auto& hook : frame_hooks_) {
+        if (hook.fn == fn && hook.userData == userData) hook = FrameHook{};
+    }
+}
+
+bool FrameHookRegistration::attach(Bridge& bridge, FrameHookFn fn, void* userData) {
+    reset();
+    if (!bridge.addFrameHook(fn, userData)) return false;
+    bridge_ = &bridge;
+    fn_ = fn;
+    user_data_ = userData;
+    return true;
+}
+
+void FrameHookRegistration::reset() {
+    if (bridge_) bridge_->removeFrameHook(fn_, user_data_);
+    bridge_ = nullptr;
+    fn_ = nullptr;
+    user_data_ = nullptr;
+}
+
 void Bridge::flushCallback(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map) {
     auto* bridge = static_cast<Bridge*>(lv_display_get_user_data(disp));
     auto* driver = bridge ? bridge->driver_ : nullptr;
@@ -231,6 +303,19 @@ void Bridge::flushCallback(lv_display_t* disp, const lv_area_t* area, uint8_t* p
         }
     }
 
+#if OC_UI_LVGL_STATIC_SURFACE_VALIDATION
+    // Only a DIRECT buffer holds a partially refreshed complete frame; other
+    // modes are passed on so the validator reports them as unsupported.
+    if (bridge && lv_display_flush_is_last(disp)) {
+        if (lv_display_get_render_mode(disp) == LV_DISPLAY_RENDER_MODE_DIRECT) {
+            auto* active = lv_display_get_buf_active(disp);
+            bridge->validation_frame_ = active && active->data ? active->data : nullptr;
+        } else {
+            bridge->validation_frame_ = px_map;
+        }
+    }
+#endif
+
     lv_display_flush_ready(disp);
 }
 
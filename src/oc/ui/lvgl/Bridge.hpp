@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include <lvgl.h>
 
 #include <oc/Config.hpp>
@@ -8,6 +10,10 @@
 #include <oc/type/Ids.hpp>
 #include <oc/type/Callbacks.hpp>
 
+#include "FrameHookRegistration.hpp"
+#include "Heap.hpp"
+#include "StaticSurfaceValidator.hpp"
+
 namespace oc::ui::lvgl {
 
 /**
@@ -25,6 +31,10 @@ struct BridgeConfig {
 
     /// Screen background color (default: black)
     lv_color_t screenBgColor{};
+
+    /// Heap regions installed before lv_init (requires OC_LVGL_CUSTOM_HEAP)
+    const heap::RegionConfig* heapRegions = nullptr;
+    size_t heapRegionCount = 0;
 };
 
 /**
@@ -80,13 +90,36 @@ public:
 
     /**
      * @brief Process LVGL timers and rendering
+     *
+     * Frame hooks run first.
      */
     void refresh();
 
+    static constexpr size_t MAX_FRAME_HOOKS = 4;
+
+    /**
+     * @brief Run fn at the start of every refresh (e.g. FrameInvalidation::commitHook)
+     *
+     * The hook stays until removed: userData must outlive it. Package types
+     * register through attach() and remove their hook when destroyed.
+     *
+     * @return false if all hook slots are used
+     */
+    bool addFrameHook(FrameHookFn fn, void* userData);
+    void removeFrameHook(FrameHookFn fn, void* userData);
+
+    /** Period of the display refresh timer: 1000 / refreshHz, or LVGL's default. */
+    [[nodiscard]] uint32_t refreshPeriodMs() const;
+
     bool isInitialized() const { return initialized_; }
     lv_display_t* getDisplay() const { return display_; }
 
 private:
+    struct FrameHook {
+        FrameHookFn fn = nullptr;
+        void* userData = nullptr;
+    };
+
     static void flushCallback(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map);
 #if OC_ENABLE_STATS
     static void displayInvalidateEvent(lv_event_t* event);
@@ -106,9 +139,13 @@ private:
     BridgeConfig config_;
     lv_display_t* display_ = nullptr;
     bool initialized_ = false;
+    std::array<FrameHook, MAX_FRAME_HOOKS> frame_hooks_{};
 #if OC_ENABLE_STATS
     RefreshDiagnostics refresh_diagnostics_{};
 #endif
+#if OC_UI_LVGL_STATIC_SURFACE_VALIDATION
+    const uint8_t* validation_frame_ = nullptr;  ///< Complete frame flushed during refresh()
+#endif
 };
 
 }  // namespace oc::ui::lvgl
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <lvgl.h>
+
+#include "IComponent.hpp"
+#include "RetainedSurfaceParkingLot.hpp"
+
+namespace oc::ui::lvgl {
+
+struct ComponentPoolStats {
+    uint8_t built = 0;       ///< Instances that exist
+    uint8_t inUse = 0;
+    uint32_t hits = 0;       ///< show() served by a parked instance
+    uint32_t misses = 0;     ///< show() that had to build an instance
+    uint32_t exhausted = 0;  ///< show() refused: all N instances in use
+};
+
+/**
+ * @brief Reusable instances of a frequently shown IComponent
+ *
+ * Modals, popups and selectors are built once, ahead of use, into a parking
+ * host. show() reparents an idle instance to the requested parent and shows
+ * it; hide() hides it, resets its state and parks it again. Showing a popup
+ * then costs a reparent and the caller's property updates instead of an
+ * object tree build, and the heap sees no churn.
+ *
+ * The reset callback returns an instance to a neutral state (selection,
+ * scroll position, text); it runs on every hide(). Instances are destroyed
+ * with the pool, including those still shown.
+ *
+ * Destroy the pool before the parking lot. If the lot goes first, its host
+ * deletion takes the parked instances with it; the pool notices, drops them
+ * and builds on demand afterwards, and instances shown at the time are
+ * destroyed on hide() instead of parked.
+ *
+ * @code
+ * ComponentPool<ConfirmDialog, 2> dialogs(lot,
+ *     [](lv_obj_t* p) { return std::make_unique<ConfirmDialog>(p); },
+ *     [](ConfirmDialog& d) { d.clear(); }, 1, lv_screen_active());
+ *
+ * if (ConfirmDialog* d = dialogs.show(lv_screen_active())) d->setText("Delete preset?");
+ * ...
+ * dialogs.hide(d);
+ * @endcode
+ *
+ * @tparam T IComponent type
+ * @tparam N Maximum instances
+ */
+template <typename T, size_t N>
+class ComponentPool {
+    static_assert(std::is_base_of_v<IComponent, T>, "ComponentPool holds IComponents");
+    static_assert(N > 0 && N < UINT8_MAX, "ComponentPool holds 1 to 254 instances");
+
+public:
+    using Factory = std::function<std::unique_ptr<T>(lv_obj_t* parent)>;
+    using ResetFn = std::function<void(T& component)>;
+
+    /**
+     * @param prewarm Instances built now (clamped to N); the rest are built on demand
+     * @param viewport Parent the instances are usually shown in; the host mirrors
+     *                 its geometry so prebuilt layouts resolve as they will be shown
+     */
+    ComponentPool(RetainedSurfaceParkingLot& lot, Factory factory, ResetFn reset = {}, size_t prewarm = N,
+                  lv_obj_t* viewport = nullptr)
+        : factory_(std::move(factory)), reset_(std::move(reset)), host_(lot.createHost()) {
+        if (!host_) return;
+        lv_obj_add_event_cb(host_, onHostDeleted, LV_EVENT_DELETE, this);
+        if (!factory_) return;
+        if (viewport) RetainedSurfaceParkingLot::mirrorViewport(host_, viewport);
+        for (size_t i = 0; i < prewarm && i < N; ++i) {
+            slots_[i].component = factory_(host_);
+            if (slots_[i].component) slots_[i].component->hide();
+        }
+    }
+
+    ~ComponentPool() {
+        if (host_) lv_obj_remove_event_cb_with_user_data(host_, onHostDeleted, this);
+        for (auto& slot : slots_) slot.component.reset();
+        if (host_) lv_obj_delete(host_);
+    }
+
+    ComponentPool(const ComponentPool&) = delete;
+    ComponentPool& operator=(const ComponentPool&) = delete;
+    ComponentPool(ComponentPool&&) = delete;
+    ComponentPool& operator=(ComponentPool&&) = delete;
+
+    /** Attaches an idle instance to parent and shows it; nullptr when exhausted. */
+    T* show(lv_obj_t* parent) {
+        if (!parent) return nullptr;
+
+        Slot* idle = nullptr;
+        Slot* empty = nullptr;
+        for (auto& slot : slots_) {
+            if (slot.inUse) continue;
+            if (slot.component) {
+                idle = &slot;
+                break;
+            }
+            if (!empty) empty = &slot;
+        }
+
+        if (idle) {
+            ++stats_.hits;
+            RetainedSurfaceParkingLot::attach(idle->component->getElement(), parent);
+        } else if (empty && factory_) {
+            ++stats_.misses;
+            empty->component = factory_(parent);
+            if (!empty->component) return nullptr;
+            idle = empty;
+        } else {
+            ++stats_.exhausted;
+            return nullptr;
+        }
+
+        idle->inUse = true;
+        idle->component->show();
+        return idle->component.get();
+    }
+
+    /** Hides, resets and parks an instance handed out by show(). */
+    void hide(T* component) {
+        Slot* slot = find(component);
+        if (!slot || !slot->inUse) return;
+
+        component->hide();
+        slot->inUse = false;
+        if (!host_) {
+            slot->component.reset();
+            return;
+        }
+        if (reset_) reset_(*component);
+        RetainedSurfaceParkingLot::park(component->getElement(), host_);
+    }
+
+    /** Hides every instance in use. */
+    void hideAll() {
+        for (auto& slot : slots_) {
+            if (slot.inUse) hide(slot.component.get());
+        }
+    }
+
+    [[nodiscard]] ComponentPoolStats stats() const {
+        ComponentPoolStats stats = stats_;
+        for (const auto& slot : slots_) {
+            if (slot.component) ++stats.built;
+            if (slot.inUse) ++stats.inUse;
+        }
+        return stats;
+    }
+
+    static constexpr size_t capacity() { return N; }
+
+private:
+    struct Slot {
+        std::unique_ptr<T> component;
+        bool inUse = false;
+    };
+
+    /** The host goes before its children: parked instances are released while still valid. */
+    static void onHostDeleted(lv_event_t* e) {
+        auto* self = static_cast<ComponentPool*>(lv_event_get_user_data(e));
+        self->host_ = nullptr;
+        for (auto& slot : self->slots_) {
+            if (!slot.inUse) slot.component.reset();
+        }
+    }
+
+    Slot* find(const T* component) {
+        if (!component) return nullptr;
+        for (auto& slot : slots_) {
+            if (slot.component.get() == component) return &slot;
+        }
+        return nullptr;
+    }
+
+    Factory factory_;
+    ResetFn reset_;
+    lv_obj_t* host_ = nullptr;
+    std::array<Slot, N> slots_{};
+    ComponentPoolStats stats_{};
+};
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,118 @@
+#include "DirtyTileMap.hpp"
+
+#include <algorithm>
+
+#include "InvalidationRegions.hpp"
+#include "StaticSurfaceInvalidation.hpp"
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+uint64_t columnMask(int32_t first, int32_t last) {
+    const uint64_t upTo = last >= 63 ? UINT64_MAX : (uint64_t{1} << (last + 1)) - 1;
+    return upTo & ~((uint64_t{1} << first) - 1);
+}
+
+}  // namespace
+
+DirtyTileMap::~DirtyTileMap() {
+    detach();
+}
+
+bool DirtyTileMap::attach(lv_display_t* display) {
+    detach();
+    if (!display) return false;
+
+    const int32_t width = lv_display_get_horizontal_resolution(display);
+    const int32_t height = lv_display_get_vertical_resolution(display);
+    if (width <= 0 || height <= 0) return false;
+
+    const int32_t longest = std::max(width, height);
+    const auto minTile = static_cast<int32_t>((longest + MAX_TILES_PER_AXIS - 1) / MAX_TILES_PER_AXIS);
+    tileSize_ = static_cast<uint16_t>(std::max<int32_t>(tileSize_, minTile));
+    columns_ = static_cast<uint8_t>((width + tileSize_ - 1) / tileSize_);
+    rows_ = static_cast<uint8_t>((height + tileSize_ - 1) / tileSize_);
+    dirty_.fill(0);
+    pendingMarks_ = 0;
+
+    if (!setStaticSurfaceTileMap(display, this)) return false;
+    display_ = display;
+    lv_display_add_event_cb(display, &DirtyTileMap::onRefreshStart, LV_EVENT_REFR_START, this);
+    return true;
+}
+
+void DirtyTileMap::detach() {
+    if (!display_) return;
+    (void)flush();
+    lv_display_remove_event_cb_with_user_data(display_, &DirtyTileMap::onRefreshStart, this);
+    (void)setStaticSurfaceTileMap(display_, nullptr);
+    display_ = nullptr;
+}
+
+void DirtyTileMap::mark(const lv_area_t& area) {
+    if (!display_ || area.x2 < area.x1 || area.y2 < area.y1) return;
+
+    const int32_t lastColumn = columns_ - 1;
+    const int32_t lastRow = rows_ - 1;
+    const int32_t x1 = std::clamp<int32_t>(area.x1 / tileSize_, 0, lastColumn);
+    const int32_t x2 = std::clamp<int32_t>(area.x2 / tileSize_, 0, lastColumn);
+    const int32_t y1 = std::clamp<int32_t>(area.y1 / tileSize_, 0, lastRow);
+    const int32_t y2 = std::clamp<int32_t>(area.y2 / tileSize_, 0, lastRow);
+
+    const uint64_t mask = columnMask(x1, x2);
+    for (int32_t row = y1; row <= y2; ++row) dirty_[row] |= mask;
+    ++pendingMarks_;
+    ++stats_.marks;
+}
+
+size_t DirtyTileMap::flush() {
+    if (!display_ || pendingMarks_ == 0) return 0;
+
+    // Row runs: each maximal run of set bits in a row, extended downwards
+    // while the next row has the same run.
+    InvalidationRegionSet<MAX_RECTANGLES> regions;
+    std::array<uint64_t, MAX_TILES_PER_AXIS> remaining = dirty_;
+    for (int32_t row = 0; row < rows_; ++row) {
+        while (remaining[row]) {
+            const int32_t first = __builtin_ctzll(remaining[row]);
+            const uint64_t shifted = ~(remaining[row] >> first);
+            const int32_t length = shifted ? __builtin_ctzll(shifted) : 64 - first;
+            const uint64_t run = columnMask(first, first + length - 1);
+
+            int32_t lastRow = row;
+            while (lastRow + 1 < rows_ && (remaining[lastRow + 1] & run) == run) ++lastRow;
+            for (int32_t r = row; r <= lastRow; ++r) remaining[r] &= ~run;
+
+            stats_.tiles += static_cast<uint32_t>(length * (lastRow - row + 1));
+            regions.add({first * tileSize_, row * tileSize_, (first + length) * tileSize_ - 1,
+                         (lastRow + 1) * tileSize_ - 1});
+        }
+    }
+
+    const uint32_t freeSlots = LV_INV_BUF_SIZE - std::min<uint32_t>(pendingInvalidAreaCount(display_), LV_INV_BUF_SIZE);
+    if (pendingMarks_ > freeSlots) ++stats_.overflowsAvoided;
+
+    const lv_area_t screen{0, 0, lv_display_get_horizontal_resolution(display_) - 1,
+                           lv_display_get_vertical_resolution(display_) - 1};
+    bool overflowed = false;
+    for (lv_area_t area : regions) {
+        area.x2 = std::min(area.x2, screen.x2);
+        area.y2 = std::min(area.y2, screen.y2);
+        overflowed |= submitInvalidArea(display_, area);
+    }
+
+    ++stats_.frames;
+    stats_.rectangles += static_cast<uint32_t>(regions.size());
+    if (overflowed) ++stats_.overflows;
+    dirty_.fill(0);
+    pendingMarks_ = 0;
+    return regions.size();
+}
+
+void DirtyTileMap::onRefreshStart(lv_event_t* event) {
+    // Runs before LVGL reads its invalid areas for this refresh.
+    if (auto* self = static_cast<DirtyTileMap*>(lv_event_get_user_data(event))) (void)self->flush();
+}
+
+}  // namespace oc::ui::lvgl
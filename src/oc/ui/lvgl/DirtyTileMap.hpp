@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+namespace oc::ui::lvgl {
+
+struct DirtyTileStats {
+    uint32_t frames = 0;              ///< Flushes with at least one marked tile
+    uint32_t marks = 0;               ///< Areas marked
+    uint32_t tiles = 0;               ///< Tiles submitted
+    uint32_t rectangles = 0;          ///< Row-run rectangles submitted to LVGL
+    uint32_t overflowsAvoided = 0;    ///< Frames whose marks alone exceeded LVGL's free area slots
+    uint32_t overflows = 0;           ///< Frames where LVGL still fell back to a full redraw
+};
+
+/**
+ * Display-level dirty-tile bitmap for static-surface invalidation.
+ *
+ * LVGL keeps LV_INV_BUF_SIZE invalid areas per display and redraws the whole
+ * screen once they are exhausted. While attached, invalidateStaticSurfaceArea()
+ * marks tiles here instead. At the start of each display refresh the tiles
+ * are submitted as row runs extended downwards, capped at half the area slots
+ * by cost-based merging. Areas are rounded out to tile bounds.
+ *
+ * Compare DirtyTileStats::overflows with staticInvalidationStats().overflows
+ * taken without a map to see how often busy frames fall back to full redraws.
+ */
+class DirtyTileMap {
+public:
+    static constexpr size_t MAX_TILES_PER_AXIS = 64;
+    static constexpr size_t MAX_RECTANGLES = LV_INV_BUF_SIZE / 2;
+
+    explicit DirtyTileMap(uint16_t tileSize = 16) : tileSize_(tileSize ? tileSize : 1) {}
+    ~DirtyTileMap();
+
+    DirtyTileMap(const DirtyTileMap&) = delete;
+    DirtyTileMap& operator=(const DirtyTileMap&) = delete;
+    DirtyTileMap(DirtyTileMap&&) = delete;
+    DirtyTileMap& operator=(DirtyTileMap&&) = delete;
+
+    /**
+     * Becomes the static-surface backend of display (one map at a time).
+     * The tile size grows if the resolution needs more than 64 tiles per axis.
+     */
+    bool attach(lv_display_t* display);
+    void detach();
+
+    void mark(const lv_area_t& area);
+
+    /** Submits marked tiles to LVGL and clears them; returns rectangles submitted. */
+    size_t flush();
+
+    [[nodiscard]] lv_display_t* display() const { return display_; }
+    [[nodiscard]] uint16_t tileSize() const { return tileSize_; }
+    [[nodiscard]] const DirtyTileStats& stats() const { return stats_; }
+
+private:
+    static void onRefreshStart(lv_event_t* event);
+
+    lv_display_t* display_ = nullptr;
+    uint16_t tileSize_;
+    uint8_t columns_ = 0;
+    uint8_t rows_ = 0;
+    std::array<uint64_t, MAX_TILES_PER_AXIS> dirty_{};  ///< One bit per tile column, per tile row
+    uint32_t pendingMarks_ = 0;
+    DirtyTileStats stats_{};
+};
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,153 @@
+#include "ElementAccounting.hpp"
+
+#include "ObjectIntrospection.hpp"
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+constexpr size_t MAX_TIMER_TARGETS = 32;
+constexpr size_t MAX_DISTINCT_REFS = 32;
+
+/// Distinct pointers, saturating: past capacity every reference counts.
+struct RefSet {
+    std::array<const void*, MAX_DISTINCT_REFS> refs{};
+    uint16_t count = 0;
+
+    void add(const void* ref) {
+        if (!ref) return;
+        const size_t known = count < refs.size() ? count : refs.size();
+        for (size_t i = 0; i < known; ++i) {
+            if (refs[i] == ref) return;
+        }
+        if (count < refs.size()) refs[count] = ref;
+        if (count < UINT16_MAX) ++count;
+    }
+};
+
+struct Walk {
+    ElementAccount& account;
+    std::array<const void*, MAX_TIMER_TARGETS> timerTargets{};
+    size_t timerTargetCount = 0;
+    RefSet images{};
+    RefSet fonts{};
+};
+
+void countClass(ElementAccount& account, const lv_obj_t* obj) {
+    const lv_obj_class_t* cls = lv_obj_get_class(obj);
+    for (size_t i = 0; i < account.classCount; ++i) {
+        if (account.classes[i].cls == cls) {
+            ++account.classes[i].count;
+            return;
+        }
+    }
+    if (account.classCount == account.classes.size()) {
+        ++account.otherClassObjects;
+        return;
+    }
+    account.classes[account.classCount++] = ElementClassCount{cls, objectClassName(obj), 1};
+}
+
+void countStyles(ElementAccount& account, const lv_obj_t* obj) {
+    const size_t styles = objectStyleCount(obj);
+    for (size_t i = 0; i < styles; ++i) {
+        ObjectStyleEntry entry{};
+        if (!objectStyleEntry(obj, i, &entry) || entry.transition) continue;
+        if (entry.local) {
+            ++account.localStyles;
+            account.styleBytes += sizeof(lv_style_t) + styleStorageBytes(entry.style) + objectStyleEntryBytes();
+        } else {
+            ++account.sharedStyles;
+            account.styleBytes += objectStyleEntryBytes();
+        }
+    }
+}
+
+void visit(Walk& walk, lv_obj_t* obj, uint8_t depth) {
+    ElementAccount& account = walk.account;
+    ++account.objects;
+    if (depth > account.maxDepth) account.maxDepth = depth;
+    account.objectBytes += objectInstanceBytes(obj);
+    countClass(account, obj);
+    countStyles(account, obj);
+
+    if (lv_obj_get_user_data(obj)) ++account.userData;
+    account.eventCallbacks += lv_obj_get_event_count(obj);
+    if (lv_anim_get(obj, nullptr)) ++account.animatedObjects;
+    for (size_t i = 0; i < walk.timerTargetCount; ++i) {
+        if (walk.timerTargets[i] == obj) ++account.timers;
+    }
+
+    if (lv_obj_check_type(obj, &lv_image_class)) walk.images.add(lv_image_get_src(obj));
+    walk.images.add(lv_obj_get_style_bg_image_src(obj, LV_PART_MAIN));
+    walk.fonts.add(lv_obj_get_style_text_font(obj, LV_PART_MAIN));
+
+    const uint8_t next = depth < UINT8_MAX ? static_cast<uint8_t>(depth + 1) : depth;
+    const uint32_t children = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < children; ++i) {
+        visit(walk, lv_obj_get_child(obj, static_cast<int32_t>(i)), next);
+    }
+}
+
+int32_t delta(size_t before, size_t after) {
+    return static_cast<int32_t>(after) - static_cast<int32_t>(before);
+}
+
+}  // namespace
+
+uint16_t ElementAccount::countOf(const lv_obj_class_t* cls) const {
+    for (size_t i = 0; i < classCount; ++i) {
+        if (classes[i].cls == cls) return classes[i].count;
+    }
+    return 0;
+}
+
+bool ElementAccountDiff::grew() const {
+    return objects > 0 || objectBytes > 0 || localStyles > 0 || styleBytes > 0 || userData > 0
+           || eventCallbacks > 0 || timers > 0;
+}
+
+ElementAccount accountElement(lv_obj_t* root) {
+    ElementAccount account{};
+    if (!root) return account;
+
+    Walk walk{account};
+    // Timers are not linked to objects; match their user data against the tree.
+    for (lv_timer_t* timer = lv_timer_get_next(nullptr); timer; timer = lv_timer_get_next(timer)) {
+        const void* target = lv_timer_get_user_data(timer);
+        if (target && walk.timerTargetCount < walk.timerTargets.size()) {
+            walk.timerTargets[walk.timerTargetCount++] = target;
+        }
+    }
+
+    visit(walk, root, 0);
+    account.images = walk.images.count;
+    account.fonts = walk.fonts.count;
+    return account;
+}
+
+ElementAccountDiff diffAccounts(const ElementAccount& before, const ElementAccount& after) {
+    ElementAccountDiff diff{};
+    diff.objects = delta(before.objects, after.objects);
+    diff.objectBytes = delta(before.objectBytes, after.objectBytes);
+    diff.localStyles = delta(before.localStyles, after.localStyles);
+    diff.styleBytes = delta(before.styleBytes, after.styleBytes);
+    diff.userData = delta(before.userData, after.userData);
+    diff.eventCallbacks = delta(before.eventCallbacks, after.eventCallbacks);
+    diff.timers = delta(before.timers, after.timers);
+    diff.animatedObjects = delta(before.animatedObjects, after.animatedObjects);
+    diff.images = delta(before.images, after.images);
+    diff.fonts = delta(before.fonts, after.fonts);
+
+    for (size_t i = 0; i < after.classCount; ++i) {
+        const ElementClassCount& counted = after.classes[i];
+        const int32_t grown = delta(before.countOf(counted.cls), counted.count);
+        if (grown > diff.grownClassDelta) {
+            diff.grownClass = counted.cls;
+            diff.grownClassDelta = grown;
+        }
+    }
+    return diff;
+}
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include "IElement.hpp"
+
+namespace oc::ui::lvgl {
+
+/** Objects of one LVGL class within an element's tree. */
+struct ElementClassCount {
+    const lv_obj_class_t* cls = nullptr;
+    const char* name = nullptr;
+    uint16_t count = 0;
+};
+
+/**
+ * @brief LVGL resources held by one element's object tree
+ *
+ * Bytes are the sizes LVGL allocates (object instances, local styles),
+ * without allocator overhead. Timers are those whose user data is an object
+ * of the tree; images and fonts are distinct sources referenced by the tree.
+ */
+struct ElementAccount {
+    static constexpr size_t MAX_CLASSES = 16;
+
+    uint32_t objects = 0;
+    size_t objectBytes = 0;
+    uint32_t localStyles = 0;
+    size_t styleBytes = 0;            ///< Local styles plus every style list entry
+    uint32_t sharedStyles = 0;        ///< Style list entries pointing at shared styles
+    uint32_t userData = 0;            ///< Objects with user data set
+    uint32_t eventCallbacks = 0;
+    uint16_t timers = 0;
+    uint16_t animatedObjects = 0;     ///< Objects with at least one running animation
+    uint16_t images = 0;
+    uint16_t fonts = 0;
+    uint8_t maxDepth = 0;
+    std::array<ElementClassCount, MAX_CLASSES> classes{};
+    uint8_t classCount = 0;
+    uint32_t otherClassObjects = 0;   ///< Objects whose class did not fit in classes
+
+    [[nodiscard]] size_t totalBytes() const { return objectBytes + styleBytes; }
+    [[nodiscard]] uint16_t countOf(const lv_obj_class_t* cls) const;
+};
+
+/** after - before, field by field. */
+struct ElementAccountDiff {
+    int32_t objects = 0;
+    int32_t objectBytes = 0;
+    int32_t localStyles = 0;
+    int32_t styleBytes = 0;
+    int32_t userData = 0;
+    int32_t eventCallbacks = 0;
+    int32_t timers = 0;
+    int32_t animatedObjects = 0;
+    int32_t images = 0;
+    int32_t fonts = 0;
+    const lv_obj_class_t* grownClass = nullptr;   ///< Class with the largest object increase
+    int32_t grownClassDelta = 0;
+
+    /** True when anything that should return to its previous value grew. */
+    [[nodiscard]] bool grew() const;
+};
+
+/**
+ * @brief Walks root's tree and accounts its LVGL resources
+ *
+ * One pass over the tree plus one over the timer list, without allocation;
+ * cheap enough for periodic debug checks on device.
+ */
+ElementAccount accountElement(lv_obj_t* root);
+
+inline ElementAccount accountElement(const IElement& element) {
+    return accountElement(element.getElement());
+}
+
+[[nodiscard]] ElementAccountDiff diffAccounts(const ElementAccount& before, const ElementAccount& after);
+
+/**
+ * @brief Leak check across lifecycle cycles of one element
+ *
+ * @code
+ * ElementAccountSnapshot check(view);
+ * view.onDeactivate();
+ * view.onActivate();
+ * if (check.diff().grew()) reportLeak(check.diff());
+ * @endcode
+ */
+class ElementAccountSnapshot {
+public:
+    explicit ElementAccountSnapshot(const IElement& element) : root_(element.getElement()) { capture(); }
+    explicit ElementAccountSnapshot(lv_obj_t* root) : root_(root) { capture(); }
+
+    /** Retakes the baseline. */
+    void capture() { baseline_ = accountElement(root_); }
+
+    [[nodiscard]] const ElementAccount& baseline() const { return baseline_; }
+    [[nodiscard]] ElementAccountDiff diff() const { return diffAccounts(baseline_, accountElement(root_)); }
+
+private:
+    lv_obj_t* root_ = nullptr;
+    ElementAccount baseline_{};
+};
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,210 @@
+#include "FontArena.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Heap.hpp"
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+constexpr size_t ALIGN = 8;
+constexpr size_t HEADER = ALIGN;  ///< Block size, padded to keep payloads aligned
+
+FontArena* g_installed = nullptr;
+FontArena* g_collecting = nullptr;
+
+size_t alignUp(size_t value) {
+    return (value + ALIGN - 1) & ~(ALIGN - 1);
+}
+
+}  // namespace
+
+FontArena::FontArena(void* region, size_t bytes) {
+    const auto address = reinterpret_cast<uintptr_t>(region);
+    const size_t skew = static_cast<size_t>(alignUp(address) - address);
+    if (!region || bytes <= skew + HEADER) return;
+
+    base_ = static_cast<uint8_t*>(region) + skew;
+    capacity_ = (bytes - skew) & ~(ALIGN - 1);
+}
+
+FontArena::~FontArena() {
+    if (g_collecting == this) g_collecting = nullptr;
+    if (g_installed == this) g_installed = nullptr;
+}
+
+bool FontArena::install(FontArena* arena) {
+    if (arena && !heap::ALLOCATOR_HOOKS) return false;
+    if (arena && !arena->base_) return false;
+    if (g_collecting) return false;
+    // Frees are routed by ownership of the installed arena: keep it until its
+    // fonts are gone.
+    if (g_installed && g_installed != arena && g_installed->segment_count_ > 0) return false;
+
+    g_installed = arena;
+    return true;
+}
+
+FontArena* FontArena::installed() {
+    return g_installed;
+}
+
+FontArena* FontArena::collecting() {
+    return g_collecting;
+}
+
+bool FontArena::owns(const void* ptr) const {
+    const auto* p = static_cast<const uint8_t*>(ptr);
+    return base_ && p >= base_ && p < base_ + capacity_;
+}
+
+size_t FontArena::blockSize(const void* ptr) const {
+    if (!owns(ptr)) return 0;
+    size_t size = 0;
+    std::memcpy(&size, static_cast<const uint8_t*>(ptr) - HEADER, sizeof(size));
+    return size;
+}
+
+FontArenaStats FontArena::stats() const {
+    FontArenaStats s{};
+    s.capacityBytes = capacity_;
+    s.usedBytes = top_;
+    s.peakBytes = peak_;
+    s.segments = static_cast<uint16_t>(segment_count_);
+    s.failedAllocations = failed_allocations_;
+    s.segmentResets = segment_resets_;
+    s.segmentOverflows = segment_overflows_;
+
+    for (size_t i = 0; i < segment_count_; ++i) {
+        const Segment& segment = segments_[i];
+        s.liveFonts = static_cast<uint16_t>(s.liveFonts + segment.fonts);
+        if (segment.open || segment.fonts > 0) {
+            s.liveBytes += (segment.open ? top_ : segment.end) - segment.begin;
+        }
+    }
+    s.reclaimableBytes = top_ - std::min(top_, s.liveBytes);
+    if (top_ > 0) {
+        s.fragmentationPct = static_cast<uint8_t>((s.reclaimableBytes * 100U) / top_);
+    }
+    return s;
+}
+
+void* FontArena::allocate(size_t bytes) {
+    const size_t size = alignUp(bytes);
+    if (size < bytes || size > capacity_ - top_ || capacity_ - top_ - size < HEADER) {
+        ++failed_allocations_;
+        return nullptr;
+    }
+
+    uint8_t* header = base_ + top_;
+    std::memcpy(header, &size, sizeof(size));
+    last_block_ = top_;
+    top_ += HEADER + size;
+    peak_ = std::max(peak_, top_);
+    return header + HEADER;
+}
+
+void* FontArena::reallocate(void* ptr, size_t bytes) {
+    if (!ptr) return allocate(bytes);
+
+    const size_t offset = static_cast<size_t>(static_cast<uint8_t*>(ptr) - base_) - HEADER;
+    const size_t old_size = blockSize(ptr);
+    const size_t size = alignUp(bytes);
+    if (offset == last_block_ && size >= bytes && size <= capacity_ - offset - HEADER) {
+        std::memcpy(base_ + offset, &size, sizeof(size));
+        top_ = offset + HEADER + size;
+        peak_ = std::max(peak_, top_);
+        return ptr;
+    }
+
+    void* moved = allocate(bytes);
+    if (!moved) return nullptr;
+    std::memcpy(moved, ptr, std::min(old_size, bytes));
+    release(ptr);
+    return moved;
+}
+
+void FontArena::release(void* ptr) {
+    if (!owns(ptr) || segment_count_ == 0) return;
+
+    // Only the newest block of the open segment can be handed back; anything
+    // else is reclaimed when its segment is reset.
+    const Segment& segment = segments_[segment_count_ - 1];
+    const size_t offset = static_cast<size_t>(static_cast<uint8_t*>(ptr) - base_) - HEADER;
+    if (segment.open && offset == last_block_ && offset >= segment.begin) {
+        top_ = offset;
+        last_block_ = SIZE_MAX;
+    }
+}
+
+void FontArena::retainFont(const void* font) {
+    if (Segment* segment = segmentOf(font)) ++segment->fonts;
+}
+
+void FontArena::releaseFont(const void* font) {
+    Segment* segment = segmentOf(font);
+    if (!segment) return;
+
+    if (segment->fonts > 0) --segment->fonts;
+    popReleasedSegments();
+}
+
+bool FontArena::beginSegment() {
+    if (!base_) return false;
+    if (segment_count_ == segments_.size()) {
+        ++segment_overflows_;
+        return false;
+    }
+
+    segments_[segment_count_++] = Segment{top_, top_, 0, true};
+    last_block_ = SIZE_MAX;
+    g_collecting = this;
+    return true;
+}
+
+void FontArena::endSegment() {
+    if (segment_count_ == 0) return;
+
+    Segment& segment = segments_[segment_count_ - 1];
+    segment.end = top_;
+    segment.open = false;
+    if (g_collecting == this) g_collecting = nullptr;
+    popReleasedSegments();
+}
+
+FontArena::Segment* FontArena::segmentOf(const void* ptr) {
+    if (!owns(ptr)) return nullptr;
+
+    const auto offset = static_cast<size_t>(static_cast<const uint8_t*>(ptr) - base_);
+    for (size_t i = 0; i < segment_count_; ++i) {
+        Segment& segment = segments_[i];
+        const size_t end = segment.open ? top_ : segment.end;
+        if (offset >= segment.begin && offset < end) return &segment;
+    }
+    return nullptr;
+}
+
+void FontArena::popReleasedSegments() {
+    while (segment_count_ > 0) {
+        const Segment& segment = segments_[segment_count_ - 1];
+        if (segment.open || segment.fonts > 0) return;
+
+        top_ = segment.begin;
+        last_block_ = SIZE_MAX;
+        --segment_count_;
+        ++segment_resets_;
+    }
+}
+
+FontArenaScope::FontArenaScope() {
+    FontArena* arena = FontArena::installed();
+    if (arena && !FontArena::collecting() && arena->beginSegment()) opened_ = arena;
+}
+
+FontArenaScope::~FontArenaScope() {
+    if (opened_) opened_->endSegment();
+}
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,142 @@
+#pragma once
+
+/**
+ * @file FontArena.hpp
+ * @brief Dedicated bump arena for LVGL binary font data
+ *
+ * Fonts loaded while an arena is installed are allocated from a user-provided
+ * region (e.g. EXTMEM/PSRAM) instead of the LVGL heap used by widgets. Each
+ * font::load call opens one segment; when every font of a segment has been
+ * freed, the segment is reset in O(1). Segments freed out of order stay
+ * buried until the segments above them are released, which is what
+ * FontArenaStats::fragmentationPct reports.
+ *
+ * Requires the package allocator hooks (see Heap.hpp). install() refuses the
+ * arena when they are not compiled in.
+ *
+ * Usage:
+ * @code
+ * EXTMEM uint8_t fontRegion[512 * 1024];
+ * oc::ui::lvgl::FontArena fontArena(fontRegion, sizeof(fontRegion));
+ *
+ * oc::ui::lvgl::FontArena::install(&fontArena);
+ * font::load(CORE_FONTS);     // one segment
+ * font::load(PLUGIN_FONTS);   // another segment
+ * font::unload(PLUGIN_FONTS); // top segment reset
+ * @endcode
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief Arena occupancy counters
+ */
+struct FontArenaStats {
+    size_t capacityBytes = 0;
+    size_t usedBytes = 0;          ///< Bump offset
+    size_t peakBytes = 0;
+    size_t liveBytes = 0;          ///< Bytes in segments that still hold fonts
+    size_t reclaimableBytes = 0;   ///< Freed segments buried under live ones
+    uint8_t fragmentationPct = 0;  ///< reclaimableBytes relative to usedBytes
+    uint16_t segments = 0;
+    uint16_t liveFonts = 0;
+    uint32_t failedAllocations = 0;
+    uint32_t segmentResets = 0;
+    uint32_t segmentOverflows = 0;  ///< Loads sent to the LVGL heap: segment table full
+};
+
+/**
+ * Stack of bump-allocated segments over a caller-owned region.
+ *
+ * The region must outlive the arena, and the arena must outlive every font
+ * allocated from it. Not thread-safe: use from the LVGL thread only.
+ */
+class FontArena {
+public:
+    static constexpr size_t MAX_SEGMENTS = 16;
+
+    FontArena(void* region, size_t bytes);
+    ~FontArena();
+
+    FontArena(const FontArena&) = delete;
+    FontArena& operator=(const FontArena&) = delete;
+    FontArena(FontArena&&) = delete;
+    FontArena& operator=(FontArena&&) = delete;
+
+    /**
+     * @brief Route subsequent font loads to arena (nullptr to detach)
+     * @return false if the allocator hooks are not compiled in
+     */
+    [[nodiscard]] static bool install(FontArena* arena);
+    [[nodiscard]] static FontArena* installed();
+
+    /// Arena currently receiving LVGL allocations, or nullptr.
+    [[nodiscard]] static FontArena* collecting();
+
+    [[nodiscard]] bool owns(const void* ptr) const;
+    [[nodiscard]] size_t blockSize(const void* ptr) const;
+    [[nodiscard]] FontArenaStats stats() const;
+
+    // Allocator interface used by the LVGL hooks while collecting.
+    void* allocate(size_t bytes);
+    void* reallocate(void* ptr, size_t bytes);
+    void release(void* ptr);
+
+    /// Count a loaded font against the segment that holds it.
+    void retainFont(const void* font);
+
+    /// Drop a freed font; resets its segment once empty and on top.
+    void releaseFont(const void* font);
+
+private:
+    friend class FontArenaScope;
+
+    struct Segment {
+        size_t begin = 0;
+        size_t end = 0;
+        uint16_t fonts = 0;
+        bool open = false;
+    };
+
+    bool beginSegment();
+    void endSegment();
+    Segment* segmentOf(const void* ptr);
+    void popReleasedSegments();
+
+    uint8_t* base_ = nullptr;
+    size_t capacity_ = 0;
+    size_t top_ = 0;
+    size_t last_block_ = SIZE_MAX;  ///< Header offset of the most recent block
+    size_t peak_ = 0;
+    std::array<Segment, MAX_SEGMENTS> segments_{};
+    size_t segment_count_ = 0;
+    uint32_t failed_allocations_ = 0;
+    uint32_t segment_resets_ = 0;
+    uint32_t segment_overflows_ = 0;
+};
+
+/**
+ * Opens a segment on the installed arena for its lifetime.
+ *
+ * Nested scopes share the outermost segment. Inactive when no arena is
+ * installed or the segment table is full; loads then use the LVGL heap.
+ */
+class FontArenaScope {
+public:
+    FontArenaScope();
+    ~FontArenaScope();
+
+    FontArenaScope(const FontArenaScope&) = delete;
+    FontArenaScope& operator=(const FontArenaScope&) = delete;
+
+    [[nodiscard]] bool active() const { return FontArena::collecting() != nullptr; }
+
+private:
+    FontArena* opened_ = nullptr;
+};
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,289 @@
+#include "FontCompression.hpp"
+
+#if LV_USE_FS_MEMFS
+
+#include <algorithm>
+#include <array>
+
+#include "FontRegistry.hpp"
+#include "MonotonicClock.hpp"
+
+namespace oc::ui::lvgl::font {
+
+namespace {
+
+using GlyphBitmapFn = const void* (*)(lv_font_glyph_dsc_t*, lv_draw_buf_t*);
+
+// Binary font layout: a "head" table label (uint32 length + 4-char tag)
+// followed by font_header_bin_t, whose compression_id is at byte 33.
+constexpr uint32_t HEAD_LABEL_BYTES = 8;
+constexpr uint32_t COMPRESSION_ID_OFFSET = HEAD_LABEL_BYTES + 33;
+
+constexpr size_t MAX_BENCHMARK_GLYPHS = 64;
+
+struct CachedFont {
+    const lv_font_t* font = nullptr;
+    GlyphBitmapFn original = nullptr;
+};
+
+struct CachedGlyph {
+    const lv_font_t* font = nullptr;
+    uint32_t index = 0;
+    uint32_t stride = 0;
+    uint32_t height = 0;
+    uint8_t* bytes = nullptr;
+    size_t size = 0;
+    uint32_t lastUse = 0;
+};
+
+std::array<CachedFont, MAX_CACHED_FONTS> g_fonts{};
+std::array<CachedGlyph, MAX_CACHED_GLYPHS> g_glyphs{};
+size_t g_budget = 4 * 1024;
+size_t g_used = 0;
+uint32_t g_clock = 0;
+uint32_t g_hits = 0;
+uint32_t g_misses = 0;
+uint32_t g_evictions = 0;
+bool g_bypass = false;  ///< Benchmark: decode every glyph
+
+CachedFont* findFont(const lv_font_t* font) {
+    for (auto& cached : g_fonts) {
+        if (cached.font && cached.font == font) return &cached;
+    }
+    return nullptr;
+}
+
+void drop(CachedGlyph& glyph) {
+    lv_free(glyph.bytes);
+    g_used -= glyph.size;
+    glyph = CachedGlyph{};
+}
+
+CachedGlyph* oldestGlyph() {
+    CachedGlyph* oldest = nullptr;
+    for (auto& glyph : g_glyphs) {
+        if (!glyph.font) continue;
+        if (!oldest || glyph.lastUse < oldest->lastUse) oldest = &glyph;
+    }
+    return oldest;
+}
+
+void trimTo(size_t budget) {
+    while (g_used > budget) {
+        CachedGlyph* oldest = oldestGlyph();
+        if (!oldest) return;
+        drop(*oldest);
+        ++g_evictions;
+    }
+}
+
+void store(const lv_font_glyph_dsc_t& dsc, const lv_draw_buf_t& buf, size_t size) {
+    trimTo(g_budget - size);
+
+    CachedGlyph* slot = nullptr;
+    for (auto& glyph : g_glyphs) {
+        if (!glyph.font) {
+            slot = &glyph;
+            break;
+        }
+    }
+    if (!slot) {
+        slot = oldestGlyph();
+        drop(*slot);
+        ++g_evictions;
+    }
+
+    auto* bytes = static_cast<uint8_t*>(lv_malloc(size));
+    if (!bytes) return;
+    lv_memcpy(bytes, buf.data, size);
+    *slot = CachedGlyph{dsc.resolved_font, dsc.gid.index, buf.header.stride, dsc.box_h,
+                        bytes, size, ++g_clock};
+    g_used += size;
+}
+
+const void* cachedGlyphBitmap(lv_font_glyph_dsc_t* dsc, lv_draw_buf_t* buf) {
+    CachedFont* cached = findFont(dsc->resolved_font);
+    if (!cached) return nullptr;
+    if (g_bypass || g_budget == 0 || dsc->req_raw_bitmap || !buf || !buf->data) {
+        return cached->original(dsc, buf);
+    }
+
+    const uint32_t stride = buf->header.stride;
+    const size_t size = static_cast<size_t>(stride) * dsc->box_h;
+    for (auto& glyph : g_glyphs) {
+        if (glyph.font == dsc->resolved_font && glyph.index == dsc->gid.index
+            && glyph.stride == stride && glyph.height == dsc->box_h) {
+            lv_memcpy(buf->data, glyph.bytes, size);
+            glyph.lastUse = ++g_clock;
+            ++g_hits;
+            return buf;
+        }
+    }
+
+    ++g_misses;
+    const void* result = cached->original(dsc, buf);
+    // Only decoded output written into buf can be replayed.
+    if (result == buf && size > 0 && size <= g_budget) store(*dsc, *buf, size);
+    return result;
+}
+
+uint32_t nextCodepoint(const char*& text) {
+    const auto lead = static_cast<uint8_t>(*text++);
+    if (lead < 0x80) return lead;
+
+    const int extra = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : 1;
+    uint32_t cp = lead & (0x3F >> extra);
+    for (int i = 0; i < extra && (*text & 0xC0) == 0x80; ++i) {
+        cp = (cp << 6) | (static_cast<uint8_t>(*text++) & 0x3F);
+    }
+    return cp;
+}
+
+/// Font loaded for the duration of a measurement when its entry is not.
+class HeldFont {
+public:
+    explicit HeldFont(const Entry& entry) : font_(*entry.target) {
+        if (font_) return;
+        font_ = acquireShared(entry.data, entry.size);
+        owned_ = font_ != nullptr;
+        if (owned_ && isCompressedEntry(entry)) enableGlyphCache(font_);
+    }
+    ~HeldFont() {
+        if (owned_) releaseShared(font_);
+    }
+    HeldFont(const HeldFont&) = delete;
+    HeldFont& operator=(const HeldFont&) = delete;
+
+    lv_font_t* get() const { return font_; }
+
+private:
+    lv_font_t* font_ = nullptr;
+    bool owned_ = false;
+};
+
+/// Average cost of one glyph bitmap request, in nanoseconds.
+uint32_t measure(const lv_font_t* font, const char* text, uint32_t iterations, uint16_t* glyphCount) {
+    std::array<lv_font_glyph_dsc_t, MAX_BENCHMARK_GLYPHS> glyphs{};
+    size_t count = 0;
+    uint32_t maxW = 1;
+    uint32_t maxH = 1;
+    for (const char* p = text; *p && count < glyphs.size();) {
+        const uint32_t cp = nextCodepoint(p);
+        lv_font_glyph_dsc_t dsc{};
+        if (!lv_font_get_glyph_dsc(font, &dsc, cp, 0) || dsc.box_w == 0 || dsc.box_h == 0) continue;
+        glyphs[count++] = dsc;
+        maxW = std::max<uint32_t>(maxW, dsc.box_w);
+        maxH = std::max<uint32_t>(maxH, dsc.box_h);
+    }
+    if (glyphCount) *glyphCount = static_cast<uint16_t>(count);
+    if (count == 0) return 0;
+
+    lv_draw_buf_t* buf = lv_draw_buf_create(maxW, maxH, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if (!buf) return 0;
+
+    auto pass = [&]() {
+        for (size_t i = 0; i < count; ++i) {
+            lv_draw_buf_reshape(buf, LV_COLOR_FORMAT_A8, glyphs[i].box_w, glyphs[i].box_h, LV_STRIDE_AUTO);
+            (void)lv_font_get_glyph_bitmap(&glyphs[i], buf);
+            lv_font_glyph_release_draw_data(&glyphs[i]);
+        }
+    };
+
+    pass();  // Warm caches
+    const uint32_t start = monotonicMicros();
+    for (uint32_t i = 0; i < iterations; ++i) pass();
+    const uint32_t elapsedUs = monotonicMicros() - start;
+
+    lv_draw_buf_destroy(buf);
+    return static_cast<uint32_t>((static_cast<uint64_t>(elapsedUs) * 1000U) / (iterations * count));
+}
+
+}  // namespace
+
+bool isCompressedFont(const uint8_t* data, uint32_t size) {
+    if (!data || size <= COMPRESSION_ID_OFFSET) return false;
+    return data[COMPRESSION_ID_OFFSET] != 0;
+}
+
+void setGlyphCacheBudget(size_t bytes) {
+    g_budget = bytes;
+    trimTo(g_budget);
+}
+
+bool enableGlyphCache(lv_font_t* font) {
+    if (!font || findFont(font)) return font != nullptr;
+
+    for (auto& cached : g_fonts) {
+        if (cached.font) continue;
+        cached.font = font;
+        cached.original = font->get_glyph_bitmap;
+        font->get_glyph_bitmap = cachedGlyphBitmap;
+        return true;
+    }
+    return false;
+}
+
+void disableGlyphCache(const lv_font_t* font) {
+    CachedFont* cached = findFont(font);
+    if (!cached) return;
+
+    for (auto& glyph : g_glyphs) {
+        if (glyph.font == font) drop(glyph);
+    }
+    const_cast<lv_font_t*>(font)->get_glyph_bitmap = cached->original;
+    *cached = CachedFont{};
+}
+
+GlyphCacheStats glyphCacheStats() {
+    GlyphCacheStats stats{};
+    stats.budgetBytes = g_budget;
+    stats.usedBytes = g_used;
+    stats.hits = g_hits;
+    stats.misses = g_misses;
+    stats.evictions = g_evictions;
+    for (const auto& glyph : g_glyphs) {
+        if (glyph.font) ++stats.glyphs;
+    }
+    for (const auto& cached : g_fonts) {
+        if (cached.font) ++stats.fonts;
+    }
+    return stats;
+}
+
+CompressionBenchmark benchmarkCompression(const Entry& compressed, const Entry* reference,
+                                          const char* sampleText, uint32_t iterations) {
+    CompressionBenchmark result{};
+    result.name = compressed.name;
+    result.flashBytes = compressed.size;
+    if (reference) {
+        result.referenceFlashBytes = reference->size;
+        result.flashSavedBytes = static_cast<int32_t>(reference->size) - static_cast<int32_t>(compressed.size);
+    }
+    if (!sampleText || iterations == 0) return result;
+
+    {
+        HeldFont font(compressed);
+        if (!font.get()) return result;
+
+        g_bypass = true;
+        result.decodeNsPerGlyph = measure(font.get(), sampleText, iterations, &result.glyphs);
+        g_bypass = false;
+        if (findFont(font.get())) {
+            result.cachedNsPerGlyph = measure(font.get(), sampleText, iterations, nullptr);
+        }
+    }
+
+    if (reference) {
+        HeldFont font(*reference);
+        if (font.get()) {
+            result.referenceNsPerGlyph = measure(font.get(), sampleText, iterations, nullptr);
+        }
+    }
+
+    result.valid = result.glyphs > 0;
+    return result;
+}
+
+}  // namespace oc::ui::lvgl::font
+
+#endif  // LV_USE_FS_MEMFS
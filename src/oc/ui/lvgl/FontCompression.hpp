@@ -0,0 +1,133 @@
+#pragma once
+
+/**
+ * @file FontCompression.hpp
+ * @brief Compressed binary fonts: glyph cache and flash/CPU benchmark
+ *
+ * LVGL binary fonts can store RLE-compressed glyph bitmaps, decompressed on
+ * every glyph draw. Entries flagged with Entry::compressed get a bounded
+ * cache of decompressed bitmaps, so repeated glyphs (digits, units) are
+ * copied instead of decoded. benchmarkCompression() measures what the
+ * trade costs per font.
+ *
+ * Usage:
+ * @code
+ * const font::Entry FONT_ENTRIES[] = {
+ *     {&fonts.regular, regular_rle_bin, regular_rle_len, "Regular", false, true},
+ * };
+ * font::setGlyphCacheBudget(8 * 1024);
+ * font::load(FONT_ENTRIES);
+ *
+ * // Flash saved versus per-glyph render cost, against an uncompressed build
+ * const font::Entry reference{&scratch, regular_bin, regular_len, "Regular", false};
+ * auto result = font::benchmarkCompression(FONT_ENTRIES[0], &reference, "0123456789 dB%");
+ * @endcode
+ *
+ * @note Compressed entries require LV_USE_FONT_COMPRESSED; font::load skips
+ * them otherwise. Entries are recognised from the font header even when
+ * Entry::compressed is not set.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include "FontLoader.hpp"
+
+namespace oc::ui::lvgl::font {
+
+#if LV_USE_FS_MEMFS
+
+/**
+ * @brief Decompressed glyph cache counters
+ */
+struct GlyphCacheStats {
+    size_t budgetBytes = 0;
+    size_t usedBytes = 0;
+    uint16_t glyphs = 0;
+    uint16_t fonts = 0;
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t evictions = 0;
+};
+
+/**
+ * @brief Flash and render cost of one font, compressed versus reference
+ *
+ * Render costs are averages over the benchmark iterations, in nanoseconds per
+ * glyph bitmap request. Reference figures are 0 without a reference entry.
+ */
+struct CompressionBenchmark {
+    const char* name = nullptr;
+    uint32_t flashBytes = 0;
+    uint32_t referenceFlashBytes = 0;
+    int32_t flashSavedBytes = 0;
+    uint16_t glyphs = 0;               ///< Glyphs in the sample text found in the font
+    uint32_t decodeNsPerGlyph = 0;     ///< Compressed, cache bypassed
+    uint32_t cachedNsPerGlyph = 0;     ///< Compressed, served from a warm cache
+    uint32_t referenceNsPerGlyph = 0;  ///< Uncompressed reference
+    bool valid = false;
+};
+
+/// Maximum compressed fonts with an attached glyph cache.
+inline constexpr size_t MAX_CACHED_FONTS = 8;
+
+/// Maximum glyphs held by the cache, whatever the byte budget.
+inline constexpr size_t MAX_CACHED_GLYPHS = 64;
+
+/**
+ * @brief Whether the binary font stores compressed bitmaps
+ *
+ * Reads the compression id of the "head" table. Returns false for data too
+ * short to hold a header.
+ */
+bool isCompressedFont(const uint8_t* data, uint32_t size);
+
+/**
+ * @brief Entry flagged compressed, or whose data turns out to be
+ *
+ * Loaders use this rather than Entry::compressed alone, so an entry built
+ * with --compress but left unflagged still gets the glyph cache.
+ */
+inline bool isCompressedEntry(const Entry& entry) {
+    return entry.compressed || isCompressedFont(entry.data, entry.size);
+}
+
+/**
+ * @brief Bytes of decompressed bitmaps kept across draws (0 disables caching)
+ *
+ * Shrinking the budget evicts immediately. Default: 4 KiB.
+ */
+void setGlyphCacheBudget(size_t bytes);
+
+/**
+ * @brief Serve this font's glyph bitmaps through the cache
+ *
+ * Called by font::load for compressed entries.
+ */
+bool enableGlyphCache(lv_font_t* font);
+
+/**
+ * @brief Detach the cache and drop the font's glyphs (called by freeFont)
+ */
+void disableGlyphCache(const lv_font_t* font);
+
+[[nodiscard]] GlyphCacheStats glyphCacheStats();
+
+/**
+ * @brief Measure flash saved against per-glyph render cost
+ *
+ * Fonts not yet loaded are loaded for the measurement and released after.
+ *
+ * @param compressed Entry flagged compressed
+ * @param reference Same font built uncompressed, or nullptr
+ * @param sampleText UTF-8 text whose glyphs are rendered
+ * @param iterations Passes over the sample text per measurement
+ */
+CompressionBenchmark benchmarkCompression(const Entry& compressed, const Entry* reference,
+                                          const char* sampleText, uint32_t iterations = 50);
+
+#endif  // LV_USE_FS_MEMFS
+
+}  // namespace oc::ui::lvgl::font
@@ -0,0 +1,196 @@
+#include "FontGlyphRecorder.hpp"
+
+#if LV_USE_FS_MEMFS
+
+#include <array>
+
+#ifndef ARDUINO
+#include <cstdio>
+#endif
+
+namespace oc::ui::lvgl::font {
+
+namespace {
+
+using GlyphDscFn = bool (*)(const lv_font_t*, lv_font_glyph_dsc_t*, uint32_t, uint32_t);
+
+constexpr uint32_t RECORDED_CODEPOINTS = 0x10000;
+constexpr size_t BITMAP_WORDS = RECORDED_CODEPOINTS / 32;
+
+struct Recording {
+    const uint8_t* data = nullptr;   ///< Font identity across unload/reload
+    const char* name = nullptr;
+    lv_font_t* font = nullptr;       ///< Attached font, nullptr while unloaded
+    GlyphDscFn original = nullptr;
+    uint32_t* bitmap = nullptr;
+    uint32_t lookups = 0;
+    uint32_t outOfRange = 0;
+};
+
+std::array<Recording, MAX_RECORDED_FONTS> g_recordings{};
+bool g_recording = false;
+
+Recording* findByFont(const lv_font_t* font) {
+    for (auto& recording : g_recordings) {
+        if (recording.font && recording.font == font) return &recording;
+    }
+    return nullptr;
+}
+
+Recording* findOrAdd(const uint8_t* data) {
+    Recording* empty = nullptr;
+    for (auto& recording : g_recordings) {
+        if (recording.data == data) return &recording;
+        if (!empty && !recording.data) empty = &recording;
+    }
+    if (empty) empty->data = data;
+    return empty;
+}
+
+bool recordingGlyphDsc(const lv_font_t* font, lv_font_glyph_dsc_t* dsc,
+                       uint32_t letter, uint32_t letterNext) {
+    Recording* recording = findByFont(font);
+    if (!recording) return false;
+
+    ++recording->lookups;
+    if (letter >= RECORDED_CODEPOINTS) {
+        ++recording->outOfRange;
+    } else {
+        if (!recording->bitmap) {
+            recording->bitmap = static_cast<uint32_t*>(lv_calloc(BITMAP_WORDS, sizeof(uint32_t)));
+        }
+        if (recording->bitmap) recording->bitmap[letter >> 5] |= 1U << (letter & 31U);
+    }
+    return recording->original(font, dsc, letter, letterNext);
+}
+
+void attach(lv_font_t* font, const Entry& entry) {
+    if (!font || font->get_glyph_dsc == recordingGlyphDsc) return;
+
+    Recording* recording = findOrAdd(entry.data);
+    if (!recording || recording->font) return;
+
+    recording->name = entry.name;
+    recording->font = font;
+    recording->original = font->get_glyph_dsc;
+    font->get_glyph_dsc = recordingGlyphDsc;
+}
+
+void detach(Recording& recording) {
+    if (!recording.font) return;
+    recording.font->get_glyph_dsc = recording.original;
+    recording.font = nullptr;
+    recording.original = nullptr;
+}
+
+bool isRecorded(const uint32_t* bitmap, uint32_t codepoint) {
+    return (bitmap[codepoint >> 5] >> (codepoint & 31U)) & 1U;
+}
+
+}  // namespace
+
+void startGlyphRecording() {
+    g_recording = true;
+}
+
+void stopGlyphRecording() {
+    g_recording = false;
+    for (auto& recording : g_recordings) detach(recording);
+}
+
+void clearGlyphRecording() {
+    stopGlyphRecording();
+    for (auto& recording : g_recordings) {
+        if (recording.bitmap) lv_free(recording.bitmap);
+        recording = Recording{};
+    }
+}
+
+bool isRecordingGlyphs() {
+    return g_recording;
+}
+
+void recordGlyphs(const Entry* entries, size_t count) {
+    if (!g_recording) return;
+    for (size_t i = 0; i < count; ++i) {
+        attach(*entries[i].target, entries[i]);
+    }
+}
+
+void forgetGlyphFont(const lv_font_t* font) {
+    if (Recording* recording = findByFont(font)) detach(*recording);
+}
+
+size_t forEachGlyphRange(GlyphRangeFn fn, void* userData) {
+    size_t ranges = 0;
+    for (const auto& recording : g_recordings) {
+        if (!recording.bitmap) continue;
+
+        uint32_t cp = 0;
+        while (cp < RECORDED_CODEPOINTS) {
+            if (!isRecorded(recording.bitmap, cp)) {
+                ++cp;
+                continue;
+            }
+            const uint32_t first = cp;
+            while (cp < RECORDED_CODEPOINTS && isRecorded(recording.bitmap, cp)) ++cp;
+            if (fn) fn(recording.name, GlyphRange{first, cp - 1}, userData);
+            ++ranges;
+        }
+    }
+    return ranges;
+}
+
+GlyphRecorderStats glyphRecorderStats() {
+    GlyphRecorderStats stats{};
+    for (const auto& recording : g_recordings) {
+        if (!recording.data) continue;
+        ++stats.fonts;
+        stats.lookups += recording.lookups;
+        stats.outOfRange += recording.outOfRange;
+        if (!recording.bitmap) continue;
+        for (size_t w = 0; w < BITMAP_WORDS; ++w) {
+            stats.distinctGlyphs += static_cast<uint32_t>(__builtin_popcount(recording.bitmap[w]));
+        }
+    }
+    return stats;
+}
+
+#ifndef ARDUINO
+bool exportGlyphRanges(const char* path) {
+    FILE* out = path ? std::fopen(path, "w") : nullptr;
+    if (!out) return false;
+
+    struct Writer {
+        FILE* out;
+        const char* font;
+    } writer{out, nullptr};
+
+    forEachGlyphRange(
+        [](const char* fontName, GlyphRange range, void* userData) {
+            auto* w = static_cast<Writer*>(userData);
+            const bool newFont = w->font != fontName;
+            if (newFont) {
+                if (w->font) std::fputc('\n', w->out);
+                std::fprintf(w->out, "%s ", fontName ? fontName : "?");
+                w->font = fontName;
+            } else {
+                std::fputc(',', w->out);
+            }
+            if (range.first == range.last) {
+                std::fprintf(w->out, "0x%X", static_cast<unsigned>(range.first));
+            } else {
+                std::fprintf(w->out, "0x%X-0x%X", static_cast<unsigned>(range.first),
+                             static_cast<unsigned>(range.last));
+            }
+        },
+        &writer);
+    if (writer.font) std::fputc('\n', out);
+
+    return std::fclose(out) == 0;
+}
+#endif
+
+}  // namespace oc::ui::lvgl::font
+
+#endif  // LV_USE_FS_MEMFS
@@ -0,0 +1,116 @@
+#pragma once
+
+/**
+ * @file FontGlyphRecorder.hpp
+ * @brief Opt-in recording of the codepoints each font is asked to render
+ *
+ * While recording, every font loaded through font::load (or attached with
+ * recordGlyphs) logs the codepoints LVGL requests from it into a per-font
+ * bitmap. Export the result as a range list to subset font builds to exactly
+ * the glyphs the UI uses.
+ *
+ * Usage (host build, e.g. after a headless scene run):
+ * @code
+ * font::startGlyphRecording();
+ * font::recordGlyphs(CORE_FONTS);   // fonts loaded before recording started
+ * runAllScenes();
+ * font::exportGlyphRanges("glyphs.txt");
+ * // Regular 0x20-0x7E,0xB0,0x2026
+ * // Icons 0xF001-0xF003,0xF00C
+ * @endcode
+ *
+ * Codepoints are recorded for the Basic Multilingual Plane (U+0000-U+FFFF);
+ * others are only counted. Bitmaps (8 KiB per font) are allocated from the
+ * LVGL heap on the first recorded glyph.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include "FontLoader.hpp"
+
+namespace oc::ui::lvgl::font {
+
+#if LV_USE_FS_MEMFS
+
+/**
+ * @brief Inclusive codepoint range
+ */
+struct GlyphRange {
+    uint32_t first;
+    uint32_t last;
+};
+
+/**
+ * @brief Recording counters
+ */
+struct GlyphRecorderStats {
+    uint16_t fonts = 0;            ///< Fonts with a recording slot
+    uint32_t lookups = 0;          ///< Glyph descriptor requests seen
+    uint32_t distinctGlyphs = 0;   ///< Distinct recorded codepoints, all fonts
+    uint32_t outOfRange = 0;       ///< Requests above U+FFFF (not recorded)
+};
+
+using GlyphRangeFn = void (*)(const char* fontName, GlyphRange range, void* userData);
+
+/// Maximum fonts recorded in one session.
+inline constexpr size_t MAX_RECORDED_FONTS = 16;
+
+/**
+ * @brief Start recording; fonts loaded from now on are attached automatically
+ */
+void startGlyphRecording();
+
+/**
+ * @brief Stop recording and detach all fonts; recorded data is kept
+ */
+void stopGlyphRecording();
+
+/**
+ * @brief Drop all recorded data and free the bitmaps
+ */
+void clearGlyphRecording();
+
+[[nodiscard]] bool isRecordingGlyphs();
+
+/**
+ * @brief Attach loaded fonts of these entries to the running recording
+ *
+ * Called by font::load for the fonts it loads. No-op when not recording.
+ */
+void recordGlyphs(const Entry* entries, size_t count);
+
+template<size_t N>
+inline void recordGlyphs(const Entry (&entries)[N]) {
+    recordGlyphs(entries, N);
+}
+
+/**
+ * @brief Detach a font before it is freed (called by freeFont)
+ */
+void forgetGlyphFont(const lv_font_t* font);
+
+/**
+ * @brief Visit recorded codepoints as ranges, font by font
+ * @return Number of ranges visited
+ */
+size_t forEachGlyphRange(GlyphRangeFn fn, void* userData);
+
+[[nodiscard]] GlyphRecorderStats glyphRecorderStats();
+
+#ifndef ARDUINO
+/**
+ * @brief Write one line per font: "<name> 0x20-0x7E,0xB0,..."
+ *
+ * The range list matches the --range syntax of lv_font_conv.
+ *
+ * @return false if the file cannot be written
+ */
+bool exportGlyphRanges(const char* path);
+#endif
+
+#endif  // LV_USE_FS_MEMFS
+
+}  // namespace oc::ui::lvgl::font
@@ -2,24 +2,42 @@
 
 #if LV_USE_FS_MEMFS
 
-#include "FontUtils.hpp"
+#include "FontArena.hpp"
+#include "FontCompression.hpp"
+#include "FontGlyphRecorder.hpp"
+#include "FontRegistry.hpp"
 
 namespace oc::ui::lvgl::font {
 
+bool loadEntry(const Entry& entry, int maxRetries, int baseDelayMs) {
+    if (*entry.target != nullptr) return true;
+#if !LV_USE_FONT_COMPRESSED
+    if (isCompressedEntry(entry)) return false;
+#endif
+
+    lv_font_t* font = acquireShared(entry.data, entry.size, nullptr, maxRetries, baseDelayMs);
+    if (font == nullptr) return false;
+
+    if (isCompressedEntry(entry)) {
+        (void)enableGlyphCache(font);
+    }
+    *entry.target = font;
+    recordGlyphs(&entry, 1);
+    return true;
+}
+
 void load(const Entry* entries, size_t count) {
+    FontArenaScope segment;
     for (size_t i = 0; i < count; ++i) {
-        const auto& e = entries[i];
-        if (*e.target == nullptr) {
-            *e.target = loadBinaryFont(e.data, e.size);
-        }
+        (void)loadEntry(entries[i]);
     }
 }
 
 void loadEssential(const Entry* entries, size_t count) {
+    FontArenaScope segment;
     for (size_t i = 0; i < count; ++i) {
-        const auto& e = entries[i];
-        if (e.essential && *e.target == nullptr) {
-            *e.target = loadBinaryFont(e.data, e.size);
+        if (entries[i].essential) {
+            (void)loadEntry(entries[i]);
         }
     }
 }
@@ -28,7 +46,7 @@ void unload(const Entry* entries, size_t count) {
     for (size_t i = 0; i < count; ++i) {
         const auto& e = entries[i];
         if (*e.target != nullptr) {
-            freeFont(*e.target);
+            releaseShared(*e.target);
         }
     }
 }
@@ -52,16 +52,33 @@ struct Entry {
     uint32_t size;           ///< Size of font data
     const char* name;        ///< Debug name
     bool essential;          ///< Load during boot/splash
+    bool compressed = false; ///< Bitmaps are RLE-compressed (see FontCompression.hpp)
 };
 
 // =============================================================================
 // Core API (non-template)
 // =============================================================================
 
+/**
+ * @brief Load one entry into *target through the shared font registry
+ *
+ * No-op if already loaded. Compressed entries get the glyph cache and are
+ * skipped when LV_USE_FONT_COMPRESSED is disabled. A running glyph recording
+ * attaches the font.
+ *
+ * @param entry Entry to load
+ * @param maxRetries Load attempts, forwarded to loadBinaryFont()
+ * @param baseDelayMs Initial retry delay, forwarded to loadBinaryFont() (0: no waiting)
+ * @return true if *entry.target holds a font afterwards
+ */
+bool loadEntry(const Entry& entry, int maxRetries = 5, int baseDelayMs = 10);
+
 /**
  * @brief Load all fonts where *target == nullptr
  *
- * Idempotent: already-loaded fonts are skipped.
+ * Idempotent: already-loaded fonts are skipped. Entries pointing at the
+ * same data share one font (see FontRegistry.hpp). With an installed
+ * FontArena, the fonts loaded by one call share one arena segment.
  *
  * @param entries Pointer to font entry array
  * @param count Number of entries
@@ -81,7 +98,9 @@ void loadEssential(const Entry* entries, size_t count);
 /**
  * @brief Unload all fonts where *target != nullptr
  *
- * Frees RAM used by loaded fonts. Safe to call multiple times.
+ * Releases one shared reference per loaded entry; a font is freed when no
+ * other loaded entry uses it. Safe to call multiple times.
+ * An arena segment is reset once all of its fonts are unloaded.
  *
  * @param entries Pointer to font entry array
  * @param count Number of entries
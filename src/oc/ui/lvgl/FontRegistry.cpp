@@ -0,0 +1,106 @@
+#include "FontRegistry.hpp"
+
+#if LV_USE_FS_MEMFS
+
+#include <array>
+
+#include "FontUtils.hpp"
+
+namespace oc::ui::lvgl::font {
+
+namespace {
+
+struct SharedFont {
+    const uint8_t* data = nullptr;
+    uint32_t size = 0;
+    lv_font_t* font = nullptr;
+    size_t footprint = 0;
+    uint16_t references = 0;
+};
+
+std::array<SharedFont, MAX_SHARED_FONTS> g_fonts{};
+uint32_t g_shared_loads = 0;
+
+SharedFont* findByData(const uint8_t* data, uint32_t size) {
+    for (auto& shared : g_fonts) {
+        if (shared.font && shared.data == data && shared.size == size) return &shared;
+    }
+    return nullptr;
+}
+
+SharedFont* findByFont(const lv_font_t* font) {
+    if (!font) return nullptr;
+    for (auto& shared : g_fonts) {
+        if (shared.font == font) return &shared;
+    }
+    return nullptr;
+}
+
+SharedFont* freeSlot() {
+    for (auto& shared : g_fonts) {
+        if (!shared.font) return &shared;
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+lv_font_t* acquireShared(const uint8_t* data, uint32_t size, bool* loaded, int maxRetries,
+                         int baseDelayMs) {
+    if (loaded) *loaded = false;
+    if (!data) return nullptr;
+
+    if (SharedFont* shared = findByData(data, size)) {
+        ++shared->references;
+        ++g_shared_loads;
+        return shared->font;
+    }
+
+    const size_t before = heapBytesInUse();
+    lv_font_t* font = loadBinaryFont(data, size, maxRetries, baseDelayMs);
+    if (!font) return nullptr;
+    if (loaded) *loaded = true;
+
+    SharedFont* slot = freeSlot();
+    if (!slot) return font;  // Registry full: the font stays private
+
+    const size_t after = heapBytesInUse();
+    *slot = SharedFont{data, size, font, after > before ? after - before : size, 1};
+    return font;
+}
+
+void releaseShared(lv_font_t*& font) {
+    SharedFont* shared = findByFont(font);
+    if (!shared) {
+        freeFont(font);
+        return;
+    }
+
+    font = nullptr;
+    if (--shared->references > 0) return;
+
+    freeFont(shared->font);
+    *shared = SharedFont{};
+}
+
+size_t sharedFootprint(const lv_font_t* font) {
+    const SharedFont* shared = findByFont(font);
+    return shared ? shared->footprint : 0;
+}
+
+RegistryStats registryStats() {
+    RegistryStats stats{};
+    stats.sharedLoads = g_shared_loads;
+    for (const auto& shared : g_fonts) {
+        if (!shared.font) continue;
+        ++stats.fonts;
+        stats.references = static_cast<uint16_t>(stats.references + shared.references);
+        stats.residentBytes += shared.footprint;
+        stats.deduplicatedBytes += shared.footprint * (shared.references - 1U);
+    }
+    return stats;
+}
+
+}  // namespace oc::ui::lvgl::font
+
+#endif  // LV_USE_FS_MEMFS
@@ -0,0 +1,79 @@
+#pragma once
+
+/**
+ * @file FontRegistry.hpp
+ * @brief Reference-counted font sharing keyed by binary data
+ *
+ * Entries from different arrays that point at the same font binary share a
+ * single lv_font_t. font::load and font::unload go through this registry, so
+ * unloading one array never frees a font another array still holds.
+ *
+ * Usage:
+ * @code
+ * // Core and plugin both list inter_14_bin
+ * font::load(CORE_FONTS);     // parses and allocates inter_14
+ * font::load(PLUGIN_FONTS);   // shares it (refcount 2)
+ * font::unload(PLUGIN_FONTS); // refcount 1, core keeps using it
+ *
+ * auto stats = font::registryStats();  // stats.deduplicatedBytes
+ * @endcode
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+namespace oc::ui::lvgl::font {
+
+#if LV_USE_FS_MEMFS
+
+/**
+ * @brief Shared font registry counters
+ */
+struct RegistryStats {
+    uint16_t fonts = 0;             ///< Distinct fonts loaded through the registry
+    uint16_t references = 0;        ///< Live references across all fonts
+    uint32_t sharedLoads = 0;       ///< Loads answered by an existing font
+    size_t residentBytes = 0;       ///< Measured heap bytes of registry fonts
+    size_t deduplicatedBytes = 0;   ///< Bytes that unshared loads would add now
+};
+
+/// Maximum distinct fonts tracked; further loads are not shared.
+inline constexpr size_t MAX_SHARED_FONTS = 32;
+
+/**
+ * @brief Load the font stored in data, or share the already loaded one
+ *
+ * @param data Binary font data (identity is the pointer, not the contents)
+ * @param size Size of font data
+ * @param loaded Set to true if this call parsed and allocated the font
+ * @param maxRetries Load attempts, forwarded to loadBinaryFont()
+ * @param baseDelayMs Initial retry delay, forwarded to loadBinaryFont()
+ * @return Shared font with one more reference, or nullptr on failure
+ */
+lv_font_t* acquireShared(const uint8_t* data, uint32_t size, bool* loaded = nullptr,
+                         int maxRetries = 5, int baseDelayMs = 10);
+
+/**
+ * @brief Drop one reference; the font is freed with the last one
+ *
+ * Fonts not loaded through the registry are freed directly.
+ *
+ * @param font Font to release (set to nullptr after)
+ */
+void releaseShared(lv_font_t*& font);
+
+/**
+ * @brief Heap bytes measured when the font was loaded
+ *
+ * Falls back to the binary size when the heap does not report usage.
+ * Returns 0 for fonts not loaded through the registry.
+ */
+size_t sharedFootprint(const lv_font_t* font);
+
+[[nodiscard]] RegistryStats registryStats();
+
+#endif  // LV_USE_FS_MEMFS
+
+}  // namespace oc::ui::lvgl::font
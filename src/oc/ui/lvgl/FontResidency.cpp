@@ -0,0 +1,208 @@
+#include "FontResidency.hpp"
+
+#if LV_USE_FS_MEMFS
+
+#include <algorithm>
+
+#include "FontCompression.hpp"
+#include "FontRegistry.hpp"
+
+namespace oc::ui::lvgl::font {
+
+ResidencyManager::ResidencyManager(size_t budgetBytes) : budget_(budgetBytes) {}
+
+ResidencyManager::~ResidencyManager() {
+    for (size_t i = 0; i < slot_count_; ++i) {
+        if (*slots_[i].entry->target != nullptr) evict(slots_[i]);
+    }
+}
+
+bool ResidencyManager::track(const Entry* entries, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const Entry& e = entries[i];
+        if (find(&e)) continue;
+        if (slot_count_ == slots_.size()) return false;
+
+        Slot& slot = slots_[slot_count_++];
+        slot = Slot{};
+        slot.entry = &e;
+        slot.footprint = e.size;
+        if (*e.target != nullptr) {
+            slot.lastUse = ++clock_;
+            charge(slot);
+        }
+    }
+    return true;
+}
+
+void ResidencyManager::untrack(const Entry* entries, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        Slot* slot = find(&entries[i]);
+        if (!slot) continue;
+
+        if (*slot->entry->target != nullptr) evict(*slot);
+        *slot = slots_[--slot_count_];
+        slots_[slot_count_] = Slot{};
+    }
+}
+
+size_t ResidencyManager::load(const Entry* entries, size_t count) {
+    (void)track(entries, count);
+
+    size_t resident = 0;
+    for (size_t i = 0; i < count; ++i) {
+        Slot* slot = find(&entries[i]);
+        if (slot && makeResident(*slot)) ++resident;
+    }
+    return resident;
+}
+
+size_t ResidencyManager::loadEssential(const Entry* entries, size_t count) {
+    (void)track(entries, count);
+
+    size_t resident = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!entries[i].essential) continue;
+        Slot* slot = find(&entries[i]);
+        if (slot && makeResident(*slot)) ++resident;
+    }
+    return resident;
+}
+
+lv_font_t* ResidencyManager::acquire(lv_font_t** target) {
+    Slot* slot = find(target);
+    if (!slot || !makeResident(*slot)) return nullptr;
+    return *target;
+}
+
+void ResidencyManager::pin(lv_font_t** target) {
+    if (Slot* slot = find(target)) ++slot->pins;
+}
+
+void ResidencyManager::unpin(lv_font_t** target) {
+    Slot* slot = find(target);
+    if (slot && slot->pins > 0) --slot->pins;
+}
+
+void ResidencyManager::setBudget(size_t budgetBytes) {
+    budget_ = budgetBytes;
+    (void)reserve(0);
+}
+
+bool ResidencyManager::reserve(size_t bytes) {
+    while (resident_bytes_ + bytes > budget_) {
+        if (!evictOldest(nullptr)) return false;
+    }
+    return true;
+}
+
+ResidencyStats ResidencyManager::stats() const {
+    ResidencyStats s = stats_;
+    s.budgetBytes = budget_;
+    s.residentBytes = resident_bytes_;
+    s.trackedFonts = static_cast<uint16_t>(slot_count_);
+    s.residentFonts = 0;
+    for (size_t i = 0; i < slot_count_; ++i) {
+        if (*slots_[i].entry->target != nullptr) ++s.residentFonts;
+    }
+    return s;
+}
+
+ResidencyManager::Slot* ResidencyManager::find(lv_font_t** target) {
+    for (size_t i = 0; i < slot_count_; ++i) {
+        if (slots_[i].entry->target == target) return &slots_[i];
+    }
+    return nullptr;
+}
+
+ResidencyManager::Slot* ResidencyManager::find(const Entry* entry) {
+    for (size_t i = 0; i < slot_count_; ++i) {
+        if (slots_[i].entry == entry) return &slots_[i];
+    }
+    return nullptr;
+}
+
+ResidencyManager::Slot* ResidencyManager::holder(const lv_font_t* font, const Slot* except) {
+    if (!font) return nullptr;
+    for (size_t i = 0; i < slot_count_; ++i) {
+        Slot& slot = slots_[i];
+        if (&slot != except && *slot.entry->target == font) return &slot;
+    }
+    return nullptr;
+}
+
+void ResidencyManager::charge(Slot& slot) {
+    const lv_font_t* font = *slot.entry->target;
+    if (const size_t measured = sharedFootprint(font)) slot.footprint = measured;
+
+    // Entries sharing a font count its bytes once.
+    slot.charged = holder(font, &slot) == nullptr;
+    if (!slot.charged) return;
+
+    resident_bytes_ += slot.footprint;
+    stats_.peakResidentBytes = std::max(stats_.peakResidentBytes, resident_bytes_);
+}
+
+bool ResidencyManager::makeResident(Slot& slot) {
+    const Entry& e = *slot.entry;
+    slot.lastUse = ++clock_;
+    if (*e.target != nullptr) return true;
+
+#if !LV_USE_FONT_COMPRESSED
+    if (isCompressedEntry(e)) {
+        ++stats_.failedLoads;
+        return false;
+    }
+#endif
+    while (resident_bytes_ + slot.footprint > budget_ && evictOldest(&slot)) {}
+
+    // A failed allocation is answered by eviction, never by waiting.
+    bool loaded = loadEntry(e, 1, 0);
+    while (!loaded && evictOldest(&slot)) {
+        loaded = loadEntry(e, 1, 0);
+    }
+    if (!loaded) {
+        ++stats_.failedLoads;
+        return false;
+    }
+
+    charge(slot);
+    ++stats_.loads;
+    if (resident_bytes_ > budget_) ++stats_.overBudgetLoads;
+    return true;
+}
+
+bool ResidencyManager::evictOldest(const Slot* keep) {
+    Slot* oldest = nullptr;
+    for (size_t i = 0; i < slot_count_; ++i) {
+        Slot& slot = slots_[i];
+        if (&slot == keep || slot.pins > 0 || slot.entry->essential) continue;
+        if (*slot.entry->target == nullptr) continue;
+        if (!oldest || slot.lastUse < oldest->lastUse) oldest = &slot;
+    }
+    if (!oldest) return false;
+
+    evict(*oldest);
+    ++stats_.evictions;
+    return true;
+}
+
+void ResidencyManager::evict(Slot& slot) {
+    // The font outlives this entry while another one shares it: hand the
+    // bytes over instead of dropping them.
+    Slot* sharer = holder(*slot.entry->target, &slot);
+    releaseShared(*slot.entry->target);
+    if (!slot.charged) return;
+
+    slot.charged = false;
+    if (sharer) {
+        sharer->charged = true;
+        sharer->footprint = slot.footprint;
+        return;
+    }
+    resident_bytes_ -= std::min(resident_bytes_, slot.footprint);
+}
+
+}  // namespace oc::ui::lvgl::font
+
+#endif  // LV_USE_FS_MEMFS
@@ -0,0 +1,186 @@
+#pragma once
+
+/**
+ * @file FontResidency.hpp
+ * @brief RAM-budgeted font residency with least-recently-used eviction
+ *
+ * Tracks the heap footprint and last use of fonts declared by font::Entry
+ * arrays. When a load would exceed the budget, unpinned non-essential fonts
+ * are evicted oldest-first. Evicted fonts are reloaded on demand through
+ * their Entry::target pointer.
+ *
+ * Usage:
+ * @code
+ * font::ResidencyManager residency(96 * 1024);
+ *
+ * residency.track(CORE_FONTS);
+ * residency.track(PLUGIN_FONTS);
+ * residency.loadEssential(CORE_FONTS);
+ *
+ * // Before building a view that uses a font
+ * lv_obj_set_style_text_font(label, residency.acquire(&fonts.regular), 0);
+ * residency.pin(&fonts.regular);    // referenced by live objects
+ *
+ * // When the view is destroyed
+ * residency.unpin(&fonts.regular);  // eligible for eviction again
+ * @endcode
+ *
+ * Evicting a font releases its shared reference (see FontRegistry.hpp); the
+ * font is freed unless another entry still holds it. Pin every font that live
+ * LVGL objects reference: only unpinned fonts are candidates for eviction.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include "FontLoader.hpp"
+
+namespace oc::ui::lvgl::font {
+
+#if LV_USE_FS_MEMFS
+
+/**
+ * @brief Residency counters for diagnostics
+ */
+struct ResidencyStats {
+    size_t budgetBytes = 0;
+    size_t residentBytes = 0;      ///< Each resident font once, however many entries share it
+    size_t peakResidentBytes = 0;
+    uint16_t trackedFonts = 0;
+    uint16_t residentFonts = 0;
+    uint32_t loads = 0;
+    uint32_t evictions = 0;
+    uint32_t failedLoads = 0;
+    uint32_t overBudgetLoads = 0;  ///< Loads that stayed over budget (nothing evictable)
+};
+
+/**
+ * @brief Keeps loaded fonts within a RAM budget
+ *
+ * Entries are referenced, not copied: tracked Entry arrays must outlive the
+ * manager (flash-resident arrays always do). Fonts still resident when the
+ * manager is destroyed are unloaded.
+ */
+class ResidencyManager {
+public:
+    static constexpr size_t MAX_FONTS = 32;
+
+    explicit ResidencyManager(size_t budgetBytes);
+    ~ResidencyManager();
+
+    ResidencyManager(const ResidencyManager&) = delete;
+    ResidencyManager& operator=(const ResidencyManager&) = delete;
+    ResidencyManager(ResidencyManager&&) = delete;
+    ResidencyManager& operator=(ResidencyManager&&) = delete;
+
+    /**
+     * @brief Register entries without loading them
+     *
+     * Fonts already loaded through font::load are adopted with their binary
+     * size as footprint estimate.
+     *
+     * @return false if MAX_FONTS would be exceeded
+     */
+    bool track(const Entry* entries, size_t count);
+
+    /**
+     * @brief Unload and forget entries
+     */
+    void untrack(const Entry* entries, size_t count);
+
+    /**
+     * @brief Make all entries resident, evicting older fonts as needed
+     * @return Number of entries resident afterwards
+     */
+    size_t load(const Entry* entries, size_t count);
+
+    /**
+     * @brief Make only essential entries resident
+     * @return Number of essential entries resident afterwards
+     */
+    size_t loadEssential(const Entry* entries, size_t count);
+
+    /**
+     * @brief Return the font stored at target, reloading it if evicted
+     *
+     * Marks the font as most recently used.
+     *
+     * @param target Entry::target of a tracked entry
+     * @return Loaded font, or nullptr if untracked or the load failed
+     */
+    lv_font_t* acquire(lv_font_t** target);
+
+    /**
+     * @brief Protect a resident font from eviction (counted)
+     */
+    void pin(lv_font_t** target);
+
+    /**
+     * @brief Release one pin taken with pin()
+     */
+    void unpin(lv_font_t** target);
+
+    /**
+     * @brief Change the budget, evicting immediately if now exceeded
+     */
+    void setBudget(size_t budgetBytes);
+
+    /**
+     * @brief Evict unpinned non-essential fonts until bytes fit the budget
+     * @return true if the requested headroom is available
+     */
+    bool reserve(size_t bytes);
+
+    [[nodiscard]] ResidencyStats stats() const;
+
+    template<size_t N>
+    bool track(const Entry (&entries)[N]) {
+        return track(entries, N);
+    }
+
+    template<size_t N>
+    void untrack(const Entry (&entries)[N]) {
+        untrack(entries, N);
+    }
+
+    template<size_t N>
+    size_t load(const Entry (&entries)[N]) {
+        return load(entries, N);
+    }
+
+    template<size_t N>
+    size_t loadEssential(const Entry (&entries)[N]) {
+        return loadEssential(entries, N);
+    }
+
+private:
+    struct Slot {
+        const Entry* entry = nullptr;
+        size_t footprint = 0;   ///< Last measured heap bytes (estimate until loaded)
+        uint32_t lastUse = 0;
+        uint16_t pins = 0;
+        bool charged = false;   ///< Counts the font in resident_bytes_ for all entries sharing it
+    };
+
+    Slot* find(lv_font_t** target);
+    Slot* find(const Entry* entry);
+    Slot* holder(const lv_font_t* font, const Slot* except);
+    void charge(Slot& slot);
+    bool makeResident(Slot& slot);
+    bool evictOldest(const Slot* keep);
+    void evict(Slot& slot);
+
+    std::array<Slot, MAX_FONTS> slots_{};
+    size_t slot_count_ = 0;
+    size_t budget_ = 0;
+    size_t resident_bytes_ = 0;
+    uint32_t clock_ = 0;
+    ResidencyStats stats_{};
+};
+
+#endif  // LV_USE_FS_MEMFS
+
+}  // namespace oc::ui::lvgl::font
@@ -2,6 +2,13 @@
 
 #if LV_USE_FS_MEMFS
 
+#include <algorithm>
+
+#include "FontArena.hpp"
+#include "FontCompression.hpp"
+#include "FontGlyphRecorder.hpp"
+#include "Heap.hpp"
+
 #ifdef ARDUINO
 #include <Arduino.h>
 #else
@@ -24,11 +31,25 @@ void delayMs(int ms) {
 }  // namespace
 
 lv_font_t* loadBinaryFont(const uint8_t* buffer, uint32_t length, int maxRetries, int baseDelayMs) {
+    heap::TagScope tag(heap::Tag::Font);
+    FontArenaScope arena;
+    if (arena.active()) {
+        // Arena loads are deterministic: a failure means the arena is full,
+        // and waiting cannot change that.
+        lv_font_t* font = lv_binfont_create_from_buffer(const_cast<void*>(static_cast<const void*>(buffer)), length);
+        if (font != nullptr) {
+            FontArena::collecting()->retainFont(font);
+        }
+        return font;
+    }
+
     for (int attempt = 0; attempt < maxRetries; ++attempt) {
         lv_font_t* font = lv_binfont_create_from_buffer(const_cast<void*>(static_cast<const void*>(buffer)), length);
         if (font != nullptr) {
             return font;
         }
+        // Nothing to wait for after the last attempt
+        if (baseDelayMs <= 0 || attempt + 1 == maxRetries) continue;
         int delayTime = baseDelayMs << attempt;  // Exponential backoff
         delayMs(delayTime);
     }
@@ -37,11 +58,28 @@ lv_font_t* loadBinaryFont(const uint8_t* buffer, uint32_t length, int maxRetries
 
 void freeFont(lv_font_t*& font) {
     if (font) {
+        FontArena* arena = FontArena::installed();
+        const bool arenaFont = arena && arena->owns(font);
+        font::forgetGlyphFont(font);
+        font::disableGlyphCache(font);
         lv_binfont_destroy(font);
+        if (arenaFont) {
+            arena->releaseFont(font);
+        }
         font = nullptr;
     }
 }
 
+size_t heapBytesInUse() {
+    lv_mem_monitor_t monitor{};
+    lv_mem_monitor(&monitor);
+    size_t used = monitor.total_size - std::min(monitor.total_size, monitor.free_size);
+    if (const FontArena* arena = FontArena::installed()) {
+        used += arena->stats().usedBytes;
+    }
+    return used;
+}
+
 }  // namespace oc::ui::lvgl
 
 #endif  // LV_USE_FS_MEMFS
@@ -5,7 +5,8 @@
  * @brief Font loading utilities for LVGL binary fonts
  *
  * Provides safe font loading with retry logic for embedded systems
- * where memory fragmentation can cause transient failures.
+ * where memory fragmentation can cause transient failures. When a FontArena
+ * is installed, fonts are allocated from it in a single attempt instead.
  *
  * Usage:
  * @code
@@ -17,6 +18,7 @@
  * @endcode
  */
 
+#include <cstddef>
 #include <cstdint>
 
 #include <lvgl.h>
@@ -29,14 +31,15 @@ namespace oc::ui::lvgl {
  * @brief Load a binary font from buffer with retry logic
  *
  * Attempts to load the font multiple times with exponential backoff
- * to handle transient memory allocation failures.
+ * to handle transient memory allocation failures. With an installed
+ * FontArena the font is loaded once into the arena and retries are skipped.
  *
  * @note Requires LV_USE_FS_MEMFS to be enabled in lv_conf.h
  *
  * @param buffer Pointer to font binary data
  * @param length Size of font data in bytes
  * @param maxRetries Maximum load attempts (default: 5)
- * @param baseDelayMs Initial retry delay in ms (doubles each retry)
+ * @param baseDelayMs Initial retry delay in ms (doubles each retry, 0 retries at once)
  * @return Loaded font pointer, or nullptr on failure
  */
 lv_font_t* loadBinaryFont(const uint8_t* buffer, uint32_t length, int maxRetries = 5,
@@ -45,12 +48,21 @@ lv_font_t* loadBinaryFont(const uint8_t* buffer, uint32_t length, int maxRetries
 /**
  * @brief Free a previously loaded binary font
  *
- * Safe to call with nullptr.
+ * Safe to call with nullptr. Arena fonts release their arena segment.
  *
  * @param font Font to free (set to nullptr after)
  */
 void freeFont(lv_font_t*& font);
 
+/**
+ * @brief Bytes currently allocated for LVGL data, including fonts
+ *
+ * LVGL heap usage plus the installed FontArena. Heaps that do not report
+ * usage (e.g. LV_STDLIB_CLIB) count as 0. Compare two readings taken around
+ * a load to measure its footprint.
+ */
+size_t heapBytesInUse();
+
 #endif  // LV_USE_FS_MEMFS
 
 }  // namespace oc::ui::lvgl
@@ -0,0 +1,154 @@
+#include "FrameClock.hpp"
+
+#include <algorithm>
+
+#include "Bridge.hpp"
+
+namespace oc::ui::lvgl {
+
+FrameClock::FrameClock(lv_display_t* display)
+    : display_(display ? display : lv_display_get_default()) {
+    if (!display_) return;
+
+    lv_display_add_event_cb(display_, onRefreshStart, LV_EVENT_REFR_START, this);
+    lv_display_add_event_cb(display_, onFlushStart, LV_EVENT_FLUSH_START, this);
+    lv_display_add_event_cb(display_, onRefreshReady, LV_EVENT_REFR_READY, this);
+}
+
+FrameClock::~FrameClock() {
+    for (auto& sub : subscriptions_) {
+        if (sub.fn) release(sub);
+    }
+    if (!display_) return;
+
+    lv_display_remove_event_cb_with_user_data(display_, onRefreshStart, this);
+    lv_display_remove_event_cb_with_user_data(display_, onFlushStart, this);
+    lv_display_remove_event_cb_with_user_data(display_, onRefreshReady, this);
+    display_ = nullptr;
+}
+
+FrameClock::SubscriptionId FrameClock::subscribe(FrameCallback fn, void* userData, lv_obj_t* owner) {
+    if (!fn) return INVALID_SUBSCRIPTION;
+
+    for (size_t i = 0; i < subscriptions_.size(); ++i) {
+        Subscription& sub = subscriptions_[i];
+        if (sub.fn) continue;
+
+        sub = Subscription{fn, userData, owner, {}, true};
+        if (owner) {
+            sub.visible = watchVisibility(owner);
+            // One delete callback per owner, shared by its subscriptions.
+            const bool watched = std::any_of(subscriptions_.begin(), subscriptions_.end(),
+                [&](const Subscription& other) { return &other != &sub && other.fn && other.owner == owner; });
+            if (!watched) lv_obj_add_event_cb(owner, onOwnerDeleted, LV_EVENT_DELETE, this);
+        }
+        return static_cast<SubscriptionId>(i);
+    }
+    return INVALID_SUBSCRIPTION;
+}
+
+void FrameClock::unsubscribe(SubscriptionId id) {
+    if (id < subscriptions_.size() && subscriptions_[id].fn) release(subscriptions_[id]);
+}
+
+void FrameClock::setEnabled(SubscriptionId id, bool enabled) {
+    if (id < subscriptions_.size() && subscriptions_[id].fn) subscriptions_[id].enabled = enabled;
+}
+
+bool FrameClock::running(SubscriptionId id) const {
+    if (id >= subscriptions_.size()) return false;
+
+    const Subscription& sub = subscriptions_[id];
+    return sub.fn && sub.enabled && ownerActive(sub);
+}
+
+FrameClockStats FrameClock::stats() const {
+    FrameClockStats stats = stats_;
+    stats.subscriptions = 0;
+    for (const auto& sub : subscriptions_) {
+        if (sub.fn) ++stats.subscriptions;
+    }
+    return stats;
+}
+
+bool FrameClock::ownerActive(const Subscription& sub) const {
+    if (!sub.owner) return true;
+    // All visibility slots taken: fall back to walking the ancestors.
+    return sub.visible.valid() ? sub.visible() : isObjectActive(sub.owner);
+}
+
+void FrameClock::release(Subscription& sub) {
+    lv_obj_t* owner = sub.owner;
+    sub = Subscription{};
+    if (!owner) return;
+
+    const bool shared = std::any_of(subscriptions_.begin(), subscriptions_.end(),
+        [owner](const Subscription& other) { return other.fn && other.owner == owner; });
+    if (!shared) lv_obj_remove_event_cb_with_user_data(owner, onOwnerDeleted, this);
+}
+
+void FrameClock::tick() {
+    const uint32_t now = lv_tick_get();
+    const FrameTick frame{stats_.frames, now, stats_.frames > 0 ? now - lastTickMs_ : 0};
+    lastTickMs_ = now;
+    ++stats_.frames;
+
+    // Callbacks may unsubscribe (themselves or others): re-check each slot.
+    for (auto& sub : subscriptions_) {
+        if (!sub.fn || !sub.enabled) continue;
+        if (!ownerActive(sub)) {
+            ++stats_.pausedCalls;
+            continue;
+        }
+        ++stats_.callbacks;
+        sub.fn(frame, sub.userData);
+    }
+}
+
+bool FrameClock::attach(Bridge& bridge) {
+    setPeriod(bridge.refreshPeriodMs());
+    return hook_.attach(bridge, &tickHook, this);
+}
+
+void FrameClock::tickHook(void* userData) {
+    auto* clock = static_cast<FrameClock*>(userData);
+    const uint32_t now = lv_tick_get();
+    // Once per refresh period, not once per main loop iteration.
+    if (clock->stats_.frames > 0 && static_cast<int32_t>(now - clock->dueMs_) < 0) return;
+
+    // Keep the refresh cadence across late ticks; restart it after a stall.
+    const bool late = clock->stats_.frames == 0 || now - clock->dueMs_ >= clock->periodMs_;
+    clock->dueMs_ = (late ? now : clock->dueMs_) + clock->periodMs_;
+    clock->tick();
+}
+
+void FrameClock::onRefreshStart(lv_event_t* event) {
+    static_cast<FrameClock*>(lv_event_get_user_data(event))->passes_ = 0;
+}
+
+void FrameClock::onFlushStart(lv_event_t* event) {
+    auto* clock = static_cast<FrameClock*>(lv_event_get_user_data(event));
+    if (clock->passes_ < UINT16_MAX) ++clock->passes_;
+}
+
+void FrameClock::onRefreshReady(lv_event_t* event) {
+    auto* clock = static_cast<FrameClock*>(lv_event_get_user_data(event));
+    FrameClockStats& stats = clock->stats_;
+    if (clock->passes_ == 0) return;
+
+    ++stats.renderedFrames;
+    stats.renderPasses += clock->passes_;
+    stats.lastRenderPasses = clock->passes_;
+    stats.maxRenderPasses = std::max(stats.maxRenderPasses, clock->passes_);
+    clock->passes_ = 0;
+}
+
+void FrameClock::onOwnerDeleted(lv_event_t* event) {
+    auto* clock = static_cast<FrameClock*>(lv_event_get_user_data(event));
+    auto* owner = static_cast<lv_obj_t*>(lv_event_get_current_target(event));
+    for (auto& sub : clock->subscriptions_) {
+        if (sub.fn && sub.owner == owner) sub = Subscription{};
+    }
+}
+
+}  // namespace oc::ui::lvgl
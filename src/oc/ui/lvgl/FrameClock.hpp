@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include "FrameHookRegistration.hpp"
+#include "VisibilityEpoch.hpp"
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief One frame as seen by subscribers
+ */
+struct FrameTick {
+    uint32_t frame = 0;     ///< Ticks since construction
+    uint32_t nowMs = 0;     ///< lv_tick_get() when the tick ran
+    uint32_t deltaMs = 0;   ///< Since the previous tick (0 on the first)
+};
+
+using FrameCallback = void (*)(const FrameTick& tick, void* userData);
+
+struct FrameClockStats {
+    uint32_t frames = 0;            ///< Ticks
+    uint32_t renderedFrames = 0;    ///< Refreshes that flushed at least one area
+    uint32_t renderPasses = 0;      ///< Areas rendered and flushed, all frames
+    uint16_t lastRenderPasses = 0;  ///< Areas rendered by the last rendered frame
+    uint16_t maxRenderPasses = 0;
+    uint32_t callbacks = 0;         ///< Subscriber calls
+    uint32_t pausedCalls = 0;       ///< Calls skipped because the owner was inactive
+    uint8_t subscriptions = 0;
+};
+
+/**
+ * Per-frame callbacks at the display refresh rate, driven by Bridge::refresh().
+ *
+ * Animated widgets subscribe here instead of each owning a PausableTimer: all
+ * callbacks run in one tick, registered as a Bridge frame hook, before
+ * lv_timer_handler() lays out and renders, so every update of a frame lands
+ * in one render instead of one per timer phase. The hook ticks once per
+ * refresh period (the bridge's refresh rate), however often the main loop
+ * runs. Ticking from the bridge rather than from the display refresh event
+ * keeps animations running while nothing is invalidated, when LVGL pauses
+ * its refresh timer altogether.
+ *
+ * The display refresh events only count render passes (see stats()).
+ *
+ * A subscription with an owner object runs only while the owner is active
+ * (see isObjectActive), so it pauses while its view is parked or hidden and
+ * is removed when the owner is deleted. Paused subscriptions resume without
+ * catching up: deltaMs is always the last tick interval.
+ *
+ * Attach the clock before FrameInvalidation so that callback invalidations
+ * join the frame transaction.
+ *
+ * @code
+ * FrameClock clock(bridge.getDisplay());
+ * clock.attach(bridge);
+ * auto id = clock.subscribe([](const FrameTick& tick, void* meter) {
+ *     static_cast<Meter*>(meter)->decay(tick.deltaMs);
+ * }, &meter, meter.getElement());
+ * @endcode
+ */
+class FrameClock {
+public:
+    using SubscriptionId = uint8_t;
+    static constexpr size_t MAX_SUBSCRIPTIONS = 32;
+    static constexpr SubscriptionId INVALID_SUBSCRIPTION = 0xFF;
+
+    /** Counts render passes of display (default if none); construct after Bridge::init(). */
+    explicit FrameClock(lv_display_t* display = nullptr);
+    ~FrameClock();
+
+    FrameClock(const FrameClock&) = delete;
+    FrameClock& operator=(const FrameClock&) = delete;
+    FrameClock(FrameClock&&) = delete;
+    FrameClock& operator=(FrameClock&&) = delete;
+
+    /** Runs the subscriptions now, whatever the period; call before lv_timer_handler(). */
+    void tick();
+
+    /** Bridge frame hook: ticks once a refresh period is due. userData is the FrameClock. */
+    static void tickHook(void* userData);
+
+    /** Ticks from bridge at its refresh period; the hook is removed on destruction. */
+    bool attach(Bridge& bridge);
+
+    /** Tick period of tickHook (default LV_DEF_REFR_PERIOD; attach() uses the bridge's). */
+    void setPeriod(uint32_t periodMs) { periodMs_ = periodMs > 0 ? periodMs : 1; }
+
+    /**
+     * @brief Run fn on every tick while owner is active
+     * @param owner Object whose activity gates the callback, or nullptr for always
+     * @return INVALID_SUBSCRIPTION if all slots are used
+     */
+    SubscriptionId subscribe(FrameCallback fn, void* userData, lv_obj_t* owner = nullptr);
+    void unsubscribe(SubscriptionId id);
+
+    /** Stop or restart a subscription, e.g. while its animation is idle. */
+    void setEnabled(SubscriptionId id, bool enabled);
+
+    /** Enabled, and its owner (if any) is active. */
+    [[nodiscard]] bool running(SubscriptionId id) const;
+
+    [[nodiscard]] bool valid() const { return display_ != nullptr; }
+    [[nodiscard]] FrameClockStats stats() const;
+
+private:
+    struct Subscription {
+        FrameCallback fn = nullptr;
+        void* userData = nullptr;
+        lv_obj_t* owner = nullptr;
+        VisibilityHandle visible{};
+        bool enabled = true;
+    };
+
+    static void onRefreshStart(lv_event_t* event);
+    static void onFlushStart(lv_event_t* event);
+    static void onRefreshReady(lv_event_t* event);
+    static void onOwnerDeleted(lv_event_t* event);
+
+    bool ownerActive(const Subscription& sub) const;
+    void release(Subscription& sub);
+
+    lv_display_t* display_ = nullptr;
+    std::array<Subscription, MAX_SUBSCRIPTIONS> subscriptions_{};
+    uint32_t lastTickMs_ = 0;
+    uint32_t dueMs_ = 0;
+    uint32_t periodMs_ = LV_DEF_REFR_PERIOD;
+    uint16_t passes_ = 0;
+    FrameClockStats stats_{};
+    FrameHookRegistration hook_{};
+};
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,43 @@
+#pragma once
+
+namespace oc::ui::lvgl {
+
+class Bridge;
+
+/// Called by Bridge::refresh() before LVGL timers and rendering run.
+using FrameHookFn = void (*)(void* userData);
+
+/**
+ * Bridge frame hook registered for the lifetime of this object.
+ *
+ * Objects whose hook receives `this` hold one, so Bridge::refresh() never
+ * calls into a destroyed object. The bridge must outlive the registration.
+ */
+class FrameHookRegistration {
+public:
+    FrameHookRegistration() = default;
+    ~FrameHookRegistration() { reset(); }
+
+    FrameHookRegistration(const FrameHookRegistration&) = delete;
+    FrameHookRegistration& operator=(const FrameHookRegistration&) = delete;
+    FrameHookRegistration(FrameHookRegistration&&) = delete;
+    FrameHookRegistration& operator=(FrameHookRegistration&&) = delete;
+
+    /**
+     * @brief Register fn with bridge, replacing any previous registration
+     * @return false if all hook slots are used
+     */
+    bool attach(Bridge& bridge, FrameHookFn fn, void* userData);
+
+    /** Removes the hook from its bridge. */
+    void reset();
+
+    [[nodiscard]] bool attached() const { return bridge_ != nullptr; }
+
+private:
+    Bridge* bridge_ = nullptr;
+    FrameHookFn fn_ = nullptr;
+    void* user_data_ = nullptr;
+};
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,97 @@
+#include "FrameInvalidation.hpp"
+
+#include "StaticSurfaceInvalidation.hpp"
+
+namespace oc::ui::lvgl {
+
+FrameInvalidation::~FrameInvalidation() {
+    (void)commit();
+}
+
+void FrameInvalidation::begin(bool suppress) {
+    if (open_) return;
+    if (!display_) display_ = lv_display_get_default();
+    if (!display_) return;
+
+    open_ = true;
+    routed_ = setStaticSurfaceTransaction(display_, this);
+    if (suppress && lv_display_is_invalidation_enabled(display_)) {
+        lv_display_enable_invalidation(display_, false);
+        owns_pause_ = true;
+    }
+}
+
+void FrameInvalidation::include(lv_obj_t* clipObject, lv_obj_t* object) {
+    if (!object) return;
+    lv_area_t area{};
+    lv_obj_get_coords(object, &area);
+    include(clipObject, area);
+}
+
+void FrameInvalidation::include(lv_obj_t* clipObject, const lv_area_t& area) {
+    if (!open_ || !clipObject || detail::areaPixels(area) == 0) return;
+    ++stats_.included;
+
+    for (std::size_t i = 0; i < entry_count_; ++i) {
+        Entry& entry = entries_[i];
+        if (entry.clipObject != clipObject) continue;
+        if (detail::areaContains(entry.area, area)) {
+            ++stats_.duplicates;
+            return;
+        }
+        if (detail::areaContains(area, entry.area)) {
+            entry.area = area;
+            return;
+        }
+    }
+
+    if (entry_count_ < entries_.size()) {
+        entries_[entry_count_++] = Entry{clipObject, area};
+        return;
+    }
+    // Entry storage is full: clip now and merge at display level.
+    addClipped(clipObject, area);
+}
+
+size_t FrameInvalidation::commit() {
+    if (!open_) return 0;
+
+    if (routed_) {
+        (void)setStaticSurfaceTransaction(display_, nullptr);
+        routed_ = false;
+    }
+    if (owns_pause_) {
+        lv_display_enable_invalidation(display_, true);
+        owns_pause_ = false;
+    }
+    open_ = false;
+
+    for (std::size_t i = 0; i < entry_count_; ++i) {
+        addClipped(entries_[i].clipObject, entries_[i].area);
+    }
+    entry_count_ = 0;
+
+    const std::size_t submitted = regions_.size();
+    for (const lv_area_t& area : regions_) {
+        invalidateStaticDisplayArea(display_, area);
+    }
+    if (submitted > 0) ++stats_.frames;
+    stats_.submitted += static_cast<uint32_t>(submitted);
+    stats_.wastedPixels += regions_.stats().wastedPixels;
+    regions_.clear();
+    return submitted;
+}
+
+void FrameInvalidation::commitHook(void* userData) {
+    if (auto* self = static_cast<FrameInvalidation*>(userData)) (void)self->commit();
+}
+
+void FrameInvalidation::addClipped(lv_obj_t* clipObject, lv_area_t area) {
+    if (lv_obj_get_display(clipObject) != display_ || !lv_obj_area_is_visible(clipObject, &area)) {
+        ++stats_.hidden;
+        return;
+    }
+    regions_.add(area);
+}
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include "FrameHookRegistration.hpp"
+#include "InvalidationRegions.hpp"
+
+namespace oc::ui::lvgl {
+
+struct FrameInvalidationStats {
+    uint32_t frames = 0;        ///< Committed transactions with at least one region
+    uint32_t included = 0;      ///< Regions registered by surfaces
+    uint32_t duplicates = 0;    ///< Regions already covered for the same clip object
+    uint32_t hidden = 0;        ///< Regions clipped away entirely
+    uint32_t submitted = 0;     ///< Areas passed to LVGL after merging
+    uint64_t wastedPixels = 0;  ///< Extra pixels from merges
+};
+
+/**
+ * Frame-level invalidation transaction across static surfaces.
+ *
+ * During the update phase each surface includes its dirty regions together
+ * with its own clip object. commit() clips every region once, deduplicates and
+ * merges them (see InvalidationRegionSet) and submits the result to the
+ * display. attach() registers commitHook with the Bridge to commit just
+ * before each render, until the transaction object is destroyed.
+ *
+ * begin() pauses display invalidation until commit(), so widget setters do not
+ * invalidate on their own. Meanwhile invalidateStaticSurfaceArea() on the
+ * display, and with it StaticSurfaceInvalidationBatch, setArcValueMinimal()
+ * and VirtualList's static-surface mode, includes its areas in the
+ * transaction. The StaticSurfaceInvalidationBatch contract then applies to
+ * the whole update phase: include every changed region, and keep effects and
+ * user callbacks out of it. Pass suppress = false to keep LVGL's own
+ * invalidation and only batch the explicit regions.
+ */
+class FrameInvalidation {
+public:
+    static constexpr size_t MAX_ENTRIES = 64;
+    static constexpr size_t MAX_REGIONS = LV_INV_BUF_SIZE / 2;
+
+    explicit FrameInvalidation(lv_display_t* display = nullptr) : display_(display) {}
+    ~FrameInvalidation();
+
+    FrameInvalidation(const FrameInvalidation&) = delete;
+    FrameInvalidation& operator=(const FrameInvalidation&) = delete;
+    FrameInvalidation(FrameInvalidation&&) = delete;
+    FrameInvalidation& operator=(FrameInvalidation&&) = delete;
+
+    /** Opens the transaction for the display (default display if none was given). */
+    void begin(bool suppress = true);
+
+    void include(lv_obj_t* clipObject, const lv_area_t& area);
+    void include(lv_obj_t* clipObject, lv_obj_t* object);
+
+    /** Resumes invalidation and submits the frame's regions; returns areas submitted. */
+    size_t commit();
+
+    /** Commits before every Bridge::refresh() render; the hook is removed on destruction. */
+    bool attach(Bridge& bridge) { return hook_.attach(bridge, &commitHook, this); }
+
+    /** Bridge frame hook: userData is the FrameInvalidation. */
+    static void commitHook(void* userData);
+
+    [[nodiscard]] bool open() const { return open_; }
+    [[nodiscard]] const FrameInvalidationStats& stats() const { return stats_; }
+
+private:
+    struct Entry {
+        lv_obj_t* clipObject = nullptr;
+        lv_area_t area{};
+    };
+
+    void addClipped(lv_obj_t* clipObject, lv_area_t area);
+
+    lv_display_t* display_ = nullptr;
+    std::array<Entry, MAX_ENTRIES> entries_{};
+    std::size_t entry_count_ = 0;
+    InvalidationRegionSet<MAX_REGIONS> regions_{};
+    bool open_ = false;
+    bool owns_pause_ = false;
+    bool routed_ = false;  ///< Receives invalidateStaticSurfaceArea() for display_
+    FrameInvalidationStats stats_{};
+    FrameHookRegistration hook_{};
+};
+
+}  // namespace oc::ui::lvgl
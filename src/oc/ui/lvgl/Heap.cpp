@@ -0,0 +1,294 @@
+#include "Heap.hpp"
+
+namespace oc::ui::lvgl::heap {
+
+namespace {
+
+Tag g_tag = Tag::Object;
+
+}  // namespace
+
+Tag currentTag() {
+    return g_tag;
+}
+
+TagScope::TagScope(Tag tag) : previous_(g_tag) {
+    g_tag = tag;
+}
+
+TagScope::~TagScope() {
+    g_tag = previous_;
+}
+
+}  // namespace oc::ui::lvgl::heap
+
+#if OC_LVGL_HEAP_HOOKS
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+
+// Draw buffer handlers are private in LVGL 9; only their malloc callbacks are
+// wrapped, to tag the allocations they make. Private LVGL headers are
+// confined to the boundary units listed in README.md.
+#include <src/draw/lv_draw_buf_private.h>
+
+static_assert(LVGL_VERSION_MAJOR == 9,
+              "Review draw buffer handler wrapping for this LVGL major");
+
+#include "FontArena.hpp"
+
+using oc::ui::lvgl::FontArena;
+using oc::ui::lvgl::TlsfRegion;
+
+namespace oc::ui::lvgl::heap {
+
+namespace {
+
+struct Region {
+    TlsfRegion heap;
+    const char* name = nullptr;
+    uint8_t tags = 0;
+};
+
+std::array<Region, MAX_REGIONS> g_regions{};
+size_t g_regionCount = 0;
+const RegionConfig* g_installedTable = nullptr;
+std::array<uint32_t, TAG_COUNT> g_fallbacks{};
+
+lv_draw_buf_malloc_cb g_drawMalloc = nullptr;
+lv_draw_buf_malloc_cb g_fontMalloc = nullptr;
+
+void* drawLayerMalloc(size_t size, lv_color_format_t cf) {
+    TagScope tag(Tag::DrawLayer);
+    return g_drawMalloc(size, cf);
+}
+
+void* glyphMalloc(size_t size, lv_color_format_t cf) {
+    TagScope tag(Tag::Font);
+    return g_fontMalloc(size, cf);
+}
+
+}  // namespace
+
+TlsfRegion* owningRegion(const void* ptr) {
+    for (size_t i = 0; i < g_regionCount; ++i) {
+        if (g_regions[i].heap.owns(ptr)) return &g_regions[i].heap;
+    }
+    return nullptr;
+}
+
+void* regionAllocate(size_t size, Tag tag) {
+    if (g_regionCount == 0) return nullptr;
+
+    const uint8_t mask = tagMask(tag);
+    for (size_t i = 0; i < g_regionCount; ++i) {
+        Region& region = g_regions[i];
+        if (!(region.tags & mask)) continue;
+        if (void* ptr = region.heap.allocate(size, static_cast<uint8_t>(tag))) return ptr;
+    }
+    ++g_fallbacks[static_cast<size_t>(tag)];
+    return nullptr;
+}
+
+InstallResult installRegions(const RegionConfig* regions, size_t count) {
+    if (!regions || count == 0 || count > MAX_REGIONS) return InstallResult::InvalidTable;
+    if (regions == g_installedTable && count == g_regionCount) return InstallResult::Ok;
+
+    // Frees are routed by region ownership: keep regions until they are empty.
+    for (size_t i = 0; i < g_regionCount; ++i) {
+        if (g_regions[i].heap.stats().liveBlocks > 0) return InstallResult::RegionsInUse;
+    }
+
+    g_regionCount = 0;
+    g_installedTable = nullptr;
+    for (size_t i = 0; i < count; ++i) {
+        const RegionConfig& config = regions[i];
+        Region& region = g_regions[g_regionCount];
+        if (!config.tags || !region.heap.init(config.memory, config.bytes)) continue;
+        region.name = config.name;
+        region.tags = config.tags;
+        ++g_regionCount;
+    }
+    if (g_regionCount == 0) return InstallResult::InvalidTable;
+    g_installedTable = regions;
+    return InstallResult::Ok;
+}
+
+bool installDrawBufferHandlers() {
+    lv_draw_buf_handlers_t* draw = lv_draw_buf_get_handlers();
+    lv_draw_buf_handlers_t* font = lv_draw_buf_get_font_handlers();
+    if (!draw || !font) return false;
+
+    if (draw->buf_malloc_cb != drawLayerMalloc) {
+        g_drawMalloc = draw->buf_malloc_cb;
+        draw->buf_malloc_cb = drawLayerMalloc;
+    }
+    if (font->buf_malloc_cb != glyphMalloc) {
+        g_fontMalloc = font->buf_malloc_cb;
+        font->buf_malloc_cb = glyphMalloc;
+    }
+    return g_drawMalloc && g_fontMalloc;
+}
+
+size_t regionCount() {
+    return g_regionCount;
+}
+
+bool regionStats(size_t index, RegionStats* out) {
+    if (!out || index >= g_regionCount) return false;
+
+    const Region& region = g_regions[index];
+    *out = RegionStats{};
+    out->name = region.name;
+    out->tags = region.tags;
+    out->heap = region.heap.stats();
+    for (size_t tag = 0; tag < TAG_COUNT; ++tag) {
+        out->tagBytes[tag] = region.heap.tagBytes(static_cast<uint8_t>(tag));
+    }
+    return true;
+}
+
+uint32_t fallbacks(Tag tag) {
+    return g_fallbacks[static_cast<size_t>(tag)];
+}
+
+}  // namespace oc::ui::lvgl::heap
+
+namespace {
+
+using oc::ui::lvgl::heap::owningRegion;
+using oc::ui::lvgl::heap::regionAllocate;
+using oc::ui::lvgl::heap::Tag;
+using oc::ui::lvgl::heap::TAG_COUNT;
+
+FontArena* owningArena(const void* ptr) {
+    FontArena* arena = FontArena::installed();
+    return arena && arena->owns(ptr) ? arena : nullptr;
+}
+
+}  // namespace
+
+// LV_STDLIB_CUSTOM contract: see lvgl/src/stdlib/lv_mem.h.
+extern "C" {
+
+void lv_mem_init(void) {}
+
+void lv_mem_deinit(void) {}
+
+lv_mem_pool_t lv_mem_add_pool(void* mem, size_t bytes) {
+    LV_UNUSED(mem);
+    LV_UNUSED(bytes);
+    return nullptr;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool) {
+    LV_UNUSED(pool);
+}
+
+void* lv_malloc_core(size_t size) {
+    if (FontArena* arena = FontArena::collecting()) return arena->allocate(size);
+    if (void* ptr = regionAllocate(size, oc::ui::lvgl::heap::currentTag())) return ptr;
+    return std::malloc(size);
+}
+
+void* lv_realloc_core(void* p, size_t new_size) {
+    if (!p) return lv_malloc_core(new_size);
+
+    if (TlsfRegion* region = owningRegion(p)) {
+        if (void* resized = region->reallocate(p, new_size)) return resized;
+
+        // Region full: move the block wherever its own tag can go, not the
+        // tag of whatever scope happens to be resizing it.
+        const uint8_t tag = region->blockTag(p);
+        void* moved = regionAllocate(new_size, tag < TAG_COUNT ? static_cast<Tag>(tag) : Tag::Object);
+        if (!moved) moved = std::malloc(new_size);
+        if (!moved) return nullptr;
+        std::memcpy(moved, p, std::min(region->blockSize(p), new_size));
+        region->release(p);
+        return moved;
+    }
+
+    FontArena* arena = owningArena(p);
+    if (!arena) return std::realloc(p, new_size);
+    if (arena == FontArena::collecting()) return arena->reallocate(p, new_size);
+
+    // Arena blocks resized outside a font load move to the C heap.
+    void* moved = std::malloc(new_size);
+    if (!moved) return nullptr;
+    std::memcpy(moved, p, std::min(arena->blockSize(p), new_size));
+    arena->release(p);
+    return moved;
+}
+
+void lv_free_core(void* p) {
+    if (TlsfRegion* region = owningRegion(p)) {
+        region->release(p);
+        return;
+    }
+    if (FontArena* arena = owningArena(p)) {
+        arena->release(p);
+        return;
+    }
+    std::free(p);
+}
+
+void lv_mem_monitor_core(lv_mem_monitor_t* mon_p) {
+    // Regions only: the C heap does not report usage.
+    oc::ui::lvgl::heap::RegionStats stats{};
+    for (size_t i = 0; oc::ui::lvgl::heap::regionStats(i, &stats); ++i) {
+        mon_p->total_size += stats.heap.capacityBytes;
+        mon_p->free_size += stats.heap.freeBytes;
+        mon_p->free_cnt += stats.heap.freeBlocks;
+        mon_p->used_cnt += stats.heap.liveBlocks;
+        mon_p->max_used += stats.heap.peakBytes;
+        mon_p->free_biggest_size = std::max(mon_p->free_biggest_size, stats.heap.largestFreeBytes);
+    }
+    if (mon_p->total_size > 0) {
+        mon_p->used_pct = static_cast<uint8_t>(100U - (mon_p->free_size * 100U) / mon_p->total_size);
+    }
+    if (mon_p->free_size > 0) {
+        mon_p->frag_pct = static_cast<uint8_t>(
+            ((mon_p->free_size - mon_p->free_biggest_size) * 100U) / mon_p->free_size);
+    }
+}
+
+lv_result_t lv_mem_test_core(void) {
+    return LV_RESULT_OK;
+}
+
+}  // extern "C"
+
+#else
+
+namespace oc::ui::lvgl::heap {
+
+InstallResult installRegions(const RegionConfig* regions, size_t count) {
+    LV_UNUSED(regions);
+    LV_UNUSED(count);
+    return InstallResult::NoAllocatorHooks;
+}
+
+bool installDrawBufferHandlers() {
+    return false;
+}
+
+size_t regionCount() {
+    return 0;
+}
+
+bool regionStats(size_t index, RegionStats* out) {
+    LV_UNUSED(index);
+    LV_UNUSED(out);
+    return false;
+}
+
+uint32_t fallbacks(Tag tag) {
+    LV_UNUSED(tag);
+    return 0;
+}
+
+}  // namespace oc::ui::lvgl::heap
+
+#endif  // OC_LVGL_HEAP_HOOKS
@@ -0,0 +1,133 @@
+#pragma once
+
+/**
+ * @file Heap.hpp
+ * @brief LVGL allocator hooks provided by this package
+ *
+ * LVGL built with LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM expects the
+ * application to implement lv_malloc_core() and friends. Define
+ * OC_LVGL_CUSTOM_HEAP=1 to let this package provide them:
+ *
+ * - allocations made while a FontArena segment is open go to that arena
+ * - with regions installed, allocations go to the first region accepting
+ *   their tag (see heap::installRegions)
+ * - everything else is served by the C heap
+ *
+ * Leave OC_LVGL_CUSTOM_HEAP undefined when the application provides its own
+ * hooks or uses another LVGL allocator.
+ *
+ * Regions let hot data live in fast RAM and show which subsystem fragments
+ * which memory. Each region is a TLSF allocator; allocations are tagged by
+ * the code that makes them: font loads (Font), draw buffers and layers
+ * (DrawLayer), and everything else (Object).
+ *
+ * @code
+ * DMAMEM uint8_t ocram[256 * 1024];
+ * EXTMEM uint8_t psram[1024 * 1024];
+ * constexpr heap::RegionConfig HEAP_REGIONS[] = {
+ *     {"OCRAM", ocram, sizeof(ocram), heap::tagMask(heap::Tag::Object) | heap::tagMask(heap::Tag::DrawLayer)},
+ *     {"EXTMEM", psram, sizeof(psram), heap::ALL_TAGS},
+ * };
+ * // BridgeConfig{.heapRegions = HEAP_REGIONS, .heapRegionCount = 2}
+ * @endcode
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include "TlsfRegion.hpp"
+
+#ifndef OC_LVGL_CUSTOM_HEAP
+#define OC_LVGL_CUSTOM_HEAP 0
+#endif
+
+#if OC_LVGL_CUSTOM_HEAP && LV_USE_STDLIB_MALLOC == LV_STDLIB_CUSTOM
+#define OC_LVGL_HEAP_HOOKS 1
+#else
+#define OC_LVGL_HEAP_HOOKS 0
+#endif
+
+namespace oc::ui::lvgl::heap {
+
+/// True when lv_malloc() is routed through this package.
+inline constexpr bool ALLOCATOR_HOOKS = OC_LVGL_HEAP_HOOKS != 0;
+
+/// Subsystem an allocation is made for.
+enum class Tag : uint8_t { Object, Font, DrawLayer };
+
+inline constexpr size_t TAG_COUNT = 3;
+inline constexpr size_t MAX_REGIONS = 4;
+
+inline constexpr uint8_t tagMask(Tag tag) {
+    return static_cast<uint8_t>(1U << static_cast<uint8_t>(tag));
+}
+
+inline constexpr uint8_t ALL_TAGS = (1U << TAG_COUNT) - 1;
+
+/// A memory range handed to LVGL and the tags it accepts, in order of preference.
+struct RegionConfig {
+    const char* name = nullptr;
+    void* memory = nullptr;
+    size_t bytes = 0;
+    uint8_t tags = ALL_TAGS;
+};
+
+/// Outcome of installRegions().
+enum class InstallResult : uint8_t {
+    Ok,
+    NoAllocatorHooks,  ///< Built without OC_LVGL_CUSTOM_HEAP or LV_STDLIB_CUSTOM
+    InvalidTable,      ///< Null, empty or oversized table, or no usable region
+    RegionsInUse,      ///< The installed regions still hold live blocks
+};
+
+struct RegionStats {
+    const char* name = nullptr;
+    uint8_t tags = 0;
+    TlsfStats heap{};
+    size_t tagBytes[TAG_COUNT] = {};   ///< Live payload per Tag
+};
+
+/**
+ * @brief Serve LVGL allocations from regions (call before lv_init)
+ *
+ * Allocations of a tag try each region accepting it, in order, then fall back
+ * to the C heap. Blocks allocated before installation stay where they are.
+ * Installing the same table again succeeds; a different table is refused
+ * while the installed regions hold live blocks.
+ *
+ * @return Ok, or why the table was refused
+ */
+[[nodiscard]] InstallResult installRegions(const RegionConfig* regions, size_t count);
+
+/**
+ * @brief Tag draw buffer allocations DrawLayer and glyph buffers Font (call after lv_init)
+ */
+bool installDrawBufferHandlers();
+
+[[nodiscard]] size_t regionCount();
+bool regionStats(size_t index, RegionStats* out);
+
+/// Allocations of tag served by the C heap because no region could.
+[[nodiscard]] uint32_t fallbacks(Tag tag);
+
+[[nodiscard]] Tag currentTag();
+
+/**
+ * Tags LVGL allocations made during its lifetime. Nested scopes restore the
+ * previous tag.
+ */
+class TagScope {
+public:
+    explicit TagScope(Tag tag);
+    ~TagScope();
+
+    TagScope(const TagScope&) = delete;
+    TagScope& operator=(const TagScope&) = delete;
+
+private:
+    Tag previous_;
+};
+
+}  // namespace oc::ui::lvgl::heap
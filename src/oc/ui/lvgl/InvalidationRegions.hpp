@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+namespace oc::ui::lvgl {
+
+/** Counters of an InvalidationRegionSet (pixels are counted once per merge). */
+struct InvalidationRegionStats {
+    uint32_t regions = 0;        ///< Areas added
+    uint32_t folded = 0;         ///< Areas contained in, or folded with, a kept region
+    uint32_t merged = 0;         ///< Overflow merges of two kept regions
+    uint64_t wastedPixels = 0;   ///< Pixels redrawn only because regions were merged
+};
+
+namespace detail {
+
+inline uint64_t areaPixels(const lv_area_t& area) {
+    if (area.x2 < area.x1 || area.y2 < area.y1) return 0;
+    return static_cast<uint64_t>(area.x2 - area.x1 + 1) * static_cast<uint64_t>(area.y2 - area.y1 + 1);
+}
+
+inline lv_area_t areaUnion(const lv_area_t& a, const lv_area_t& b) {
+    return {std::min(a.x1, b.x1), std::min(a.y1, b.y1), std::max(a.x2, b.x2), std::max(a.y2, b.y2)};
+}
+
+inline lv_area_t areaIntersection(const lv_area_t& a, const lv_area_t& b) {
+    return {std::max(a.x1, b.x1), std::max(a.y1, b.y1), std::min(a.x2, b.x2), std::min(a.y2, b.y2)};
+}
+
+inline bool areaContains(const lv_area_t& outer, const lv_area_t& inner) {
+    return inner.x1 >= outer.x1 && inner.y1 >= outer.y1 && inner.x2 <= outer.x2 && inner.y2 <= outer.y2;
+}
+
+/** Pixels the bounding box of a and b covers that neither a nor b does. */
+inline uint64_t mergeCost(const lv_area_t& a, const lv_area_t& b) {
+    const uint64_t covered = areaPixels(a) + areaPixels(b) - areaPixels(areaIntersection(a, b));
+    return areaPixels(areaUnion(a, b)) - covered;
+}
+
+}  // namespace detail
+
+/**
+ * Bounded set of invalid areas.
+ *
+ * Areas contained in a kept region are dropped; overlapping areas are folded
+ * into their union when it is no larger than the sum of their areas. When
+ * more than MaxRegions areas remain, the pair whose bounding box adds the
+ * fewest uncovered pixels is merged, so distant small areas stay separate
+ * instead of collapsing into one large box.
+ */
+template <std::size_t MaxRegions>
+class InvalidationRegionSet {
+    static_assert(MaxRegions > 0, "InvalidationRegionSet requires storage");
+
+public:
+    void add(const lv_area_t& area) {
+        if (detail::areaPixels(area) == 0) return;
+        ++stats_.regions;
+
+        lv_area_t pending = area;
+        if (absorb(pending)) return;
+        regions_[count_++] = pending;
+
+        if (count_ <= MaxRegions) return;
+        mergeCheapestPair();
+    }
+
+    void clear() {
+        count_ = 0;
+        stats_ = {};
+    }
+
+    static constexpr std::size_t capacity() { return MaxRegions; }
+    [[nodiscard]] std::size_t size() const { return count_; }
+    [[nodiscard]] bool empty() const { return count_ == 0; }
+    [[nodiscard]] const lv_area_t& operator[](std::size_t index) const { return regions_[index]; }
+    [[nodiscard]] const lv_area_t* begin() const { return regions_.data(); }
+    [[nodiscard]] const lv_area_t* end() const { return regions_.data() + count_; }
+    [[nodiscard]] const InvalidationRegionStats& stats() const { return stats_; }
+
+private:
+    /**
+     * Folds pending into kept regions. Returns true when it is covered by one;
+     * otherwise pending has grown to include every region it overlapped.
+     */
+    bool absorb(lv_area_t& pending) {
+        for (std::size_t i = 0; i < count_;) {
+            const lv_area_t& kept = regions_[i];
+            if (detail::areaContains(kept, pending)) {
+                ++stats_.folded;
+                return true;
+            }
+            // Fold only when the union costs no more than drawing both (the
+            // rule LVGL uses to join areas); thin overlapping strips stay apart.
+            const lv_area_t both = detail::areaUnion(kept, pending);
+            if (detail::areaPixels(detail::areaIntersection(kept, pending)) == 0
+                || detail::areaPixels(both) > detail::areaPixels(kept) + detail::areaPixels(pending)) {
+                ++i;
+                continue;
+            }
+
+            // Overlap: the grown area may now touch regions already checked.
+            stats_.wastedPixels += detail::mergeCost(kept, pending);
+            pending = both;
+            ++stats_.folded;
+            remove(i);
+            i = 0;
+        }
+        return false;
+    }
+
+    void mergeCheapestPair() {
+        std::size_t bestA = 0;
+        std::size_t bestB = 1;
+        uint64_t bestCost = UINT64_MAX;
+        for (std::size_t a = 0; a + 1 < count_; ++a) {
+            for (std::size_t b = a + 1; b < count_; ++b) {
+                const uint64_t cost = detail::mergeCost(regions_[a], regions_[b]);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestA = a;
+                    bestB = b;
+                }
+            }
+        }
+
+        lv_area_t merged = detail::areaUnion(regions_[bestA], regions_[bestB]);
+        stats_.wastedPixels += bestCost;
+        ++stats_.merged;
+        remove(bestB);
+        remove(bestA);
+        if (!absorb(merged)) regions_[count_++] = merged;
+    }
+
+    void remove(std::size_t index) {
+        regions_[index] = regions_[--count_];
+    }
+
+    // One spare slot holds the area being added while the set is full.
+    std::array<lv_area_t, MaxRegions + 1> regions_{};
+    std::size_t count_ = 0;
+    InvalidationRegionStats stats_{};
+};
+
+}  // namespace oc::ui::lvgl
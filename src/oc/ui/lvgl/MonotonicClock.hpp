@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+namespace oc::ui::lvgl {
+
+/** Wrapping microsecond counter for package benchmarks and latency stats. */
+inline uint32_t monotonicMicros() {
+#ifdef ARDUINO
+    return micros();
+#else
+    using namespace std::chrono;
+    return static_cast<uint32_t>(
+        duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+}  // namespace oc::ui::lvgl
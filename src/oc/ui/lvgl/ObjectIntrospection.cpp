@@ -0,0 +1,140 @@
+#include "ObjectIntrospection.hpp"
+
+// LVGL 9 keeps object style lists and style storage private. Private LVGL
+// headers are confined to the boundary units listed in README.md.
+#include <src/core/lv_obj_class_private.h>
+#include <src/core/lv_obj_private.h>
+#include <src/core/lv_obj_style_private.h>
+
+static_assert(LVGL_VERSION_MAJOR == 9,
+              "Review style introspection for this LVGL major");
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+/// Marker prop_cnt of styles defined with LV_STYLE_CONST_INIT.
+constexpr uint8_t CONST_STYLE_PROPS = 0xFF;
+
+bool isColorProp(lv_style_prop_t prop) {
+    switch (prop) {
+        case LV_STYLE_BG_COLOR:
+        case LV_STYLE_BG_GRAD_COLOR:
+        case LV_STYLE_BG_IMAGE_RECOLOR:
+        case LV_STYLE_BORDER_COLOR:
+        case LV_STYLE_OUTLINE_COLOR:
+        case LV_STYLE_SHADOW_COLOR:
+        case LV_STYLE_IMAGE_RECOLOR:
+        case LV_STYLE_LINE_COLOR:
+        case LV_STYLE_ARC_COLOR:
+        case LV_STYLE_TEXT_COLOR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool isPointerProp(lv_style_prop_t prop) {
+    switch (prop) {
+        case LV_STYLE_TEXT_FONT:
+        case LV_STYLE_BG_IMAGE_SRC:
+        case LV_STYLE_ARC_IMAGE_SRC:
+        case LV_STYLE_BG_GRAD:
+        case LV_STYLE_COLOR_FILTER_DSC:
+        case LV_STYLE_ANIM:
+        case LV_STYLE_TRANSITION:
+        case LV_STYLE_BITMAP_MASK_SRC:
+        case LV_STYLE_GRID_COLUMN_DSC_ARRAY:
+        case LV_STYLE_GRID_ROW_DSC_ARRAY:
+        case LV_STYLE_IMAGE_COLORKEY:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+size_t objectStyleCount(const lv_obj_t* obj) {
+    return obj ? obj->style_cnt : 0;
+}
+
+bool objectStyleEntry(const lv_obj_t* obj, size_t index, ObjectStyleEntry* out) {
+    if (!obj || !out || index >= obj->style_cnt) return false;
+
+    const lv_obj_style_t& entry = obj->styles[index];
+    out->style = entry.style;
+    out->selector = entry.selector;
+    out->local = entry.is_local;
+    out->transition = entry.is_trans;
+    return true;
+}
+
+size_t styleProperties(const lv_style_t* style, StyleProperty* out, size_t capacity) {
+    if (!style || !style->values_and_props) return 0;
+
+    if (style->prop_cnt == CONST_STYLE_PROPS) {
+        const auto* props = static_cast<const lv_style_const_prop_t*>(style->values_and_props);
+        size_t count = 0;
+        for (; props[count].prop != LV_STYLE_PROP_INV; ++count) {
+            if (out && count < capacity) out[count] = StyleProperty{props[count].prop, props[count].value};
+        }
+        return count;
+    }
+
+    // Mutable styles: prop_cnt values followed by prop_cnt property ids.
+    const auto* values = static_cast<const lv_style_value_t*>(style->values_and_props);
+    const auto* props = reinterpret_cast<const lv_style_prop_t*>(values + style->prop_cnt);
+    for (size_t i = 0; out && i < style->prop_cnt && i < capacity; ++i) {
+        out[i] = StyleProperty{props[i], values[i]};
+    }
+    return style->prop_cnt;
+}
+
+size_t styleStorageBytes(const lv_style_t* style) {
+    if (!style || style->prop_cnt == CONST_STYLE_PROPS) return 0;
+    return static_cast<size_t>(style->prop_cnt) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
+}
+
+size_t objectStyleEntryBytes() {
+    return sizeof(lv_obj_style_t);
+}
+
+size_t objectInstanceBytes(const lv_obj_t* obj) {
+    if (!obj || !obj->class_p) return 0;
+
+    // instance_size is inherited from the nearest base class that sets it.
+    size_t bytes = 0;
+    for (const lv_obj_class_t* cls = obj->class_p; cls && bytes == 0; cls = cls->base_class) {
+        bytes = cls->instance_size;
+    }
+    if (obj->spec_attr) bytes += sizeof(lv_obj_spec_attr_t);
+    return bytes;
+}
+
+const char* objectClassName(const lv_obj_t* obj) {
+    return obj && obj->class_p ? obj->class_p->name : nullptr;
+}
+
+bool sameStyleValue(lv_style_prop_t prop, const lv_style_value_t& a, const lv_style_value_t& b) {
+    if (isColorProp(prop)) {
+        return a.color.red == b.color.red && a.color.green == b.color.green && a.color.blue == b.color.blue;
+    }
+    // Setters fill only the member they use; compare that member alone.
+    if (isPointerProp(prop)) return a.ptr == b.ptr;
+    return a.num == b.num;
+}
+
+uint32_t styleValueHash(lv_style_prop_t prop, const lv_style_value_t& value) {
+    if (isColorProp(prop)) {
+        return static_cast<uint32_t>(value.color.red) | (static_cast<uint32_t>(value.color.green) << 8)
+               | (static_cast<uint32_t>(value.color.blue) << 16);
+    }
+    if (isPointerProp(prop)) {
+        const auto address = reinterpret_cast<uintptr_t>(value.ptr);
+        return static_cast<uint32_t>(address ^ (static_cast<uint64_t>(address) >> 32));
+    }
+    return static_cast<uint32_t>(value.num);
+}
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+namespace oc::ui::lvgl {
+
+/**
+ * Read-only views into LVGL object and style internals.
+ *
+ * LVGL 9 keeps an object's style list and a style's property storage
+ * private. ObjectIntrospection.cpp is the only translation unit that reads
+ * them; everything else goes through these functions.
+ */
+
+/** One entry of an object's style list. */
+struct ObjectStyleEntry {
+    const lv_style_t* style = nullptr;
+    lv_style_selector_t selector = 0;
+    bool local = false;        ///< Allocated for the object by lv_obj_set_style_*()
+    bool transition = false;   ///< Temporary style of a running transition
+};
+
+/** One property of a style. */
+struct StyleProperty {
+    lv_style_prop_t prop = 0;
+    lv_style_value_t value{};
+};
+
+[[nodiscard]] size_t objectStyleCount(const lv_obj_t* obj);
+
+/** Entry index of obj's style list (highest precedence first); false when out of range. */
+bool objectStyleEntry(const lv_obj_t* obj, size_t index, ObjectStyleEntry* out);
+
+/**
+ * @brief Copies up to capacity properties of style into out
+ * @return Total properties in the style (may exceed capacity)
+ */
+size_t styleProperties(const lv_style_t* style, StyleProperty* out, size_t capacity);
+
+/** Heap bytes held by a mutable style's property storage (0 for const styles). */
+[[nodiscard]] size_t styleStorageBytes(const lv_style_t* style);
+
+/** Heap bytes of one style list entry of an object. */
+[[nodiscard]] size_t objectStyleEntryBytes();
+
+/** Heap bytes of the object itself: its class instance plus lazily allocated attributes. */
+[[nodiscard]] size_t objectInstanceBytes(const lv_obj_t* obj);
+
+/** Name of the object's class, or nullptr. */
+[[nodiscard]] const char* objectClassName(const lv_obj_t* obj);
+
+/** Whether the two values of prop are equal. */
+[[nodiscard]] bool sameStyleValue(lv_style_prop_t prop, const lv_style_value_t& a, const lv_style_value_t& b);
+
+/** Hash of the value of prop, equal for values sameStyleValue() considers equal. */
+[[nodiscard]] uint32_t styleValueHash(lv_style_prop_t prop, const lv_style_value_t& value);
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "FrameHookRegistration.hpp"
+
+namespace oc::ui::lvgl {
+
+struct ParameterMailboxStats {
+    uint32_t posts = 0;       ///< Values written by producers
+    uint32_t delivered = 0;   ///< Values handed to the UI
+    uint32_t drains = 0;      ///< Drains that delivered at least one value
+};
+
+/**
+ * Latest-value-wins mailbox from input producers to the UI frame.
+ *
+ * Encoder and MIDI handlers (ISRs or other threads) post() parameter values
+ * at any rate without locking; each post overwrites the previous value and
+ * marks the parameter dirty. drain(), typically run as a Bridge frame hook,
+ * delivers each changed parameter once with its latest value, so the UI only
+ * handles states that can be shown. Dirty words are found through a summary
+ * word, so a drain costs one atomic exchange plus one per word with changes.
+ *
+ * A value posted while its parameter is being drained can be delivered again
+ * on the next drain; delivery is idempotent for display purposes. Attach the
+ * mailbox before FrameInvalidation so delivered values are part of the same
+ * frame's transaction.
+ *
+ * @code
+ * ParameterMailbox<128> params(
+ *     [](uint16_t id, int32_t value, void* ui) { static_cast<Ui*>(ui)->show(id, value); }, &ui);
+ * params.attach(bridge);
+ * // ISR: params.post(CUTOFF, raw);
+ * @endcode
+ *
+ * @tparam N Parameters (at most 1024)
+ * @tparam T Value type, lock-free as std::atomic<T>
+ */
+template <size_t N, typename T = int32_t>
+class ParameterMailbox {
+    static constexpr size_t WORDS = (N + 31) / 32;
+    static_assert(N > 0 && WORDS <= 32, "ParameterMailbox holds 1 to 1024 parameters");
+    static_assert(std::atomic<T>::is_always_lock_free, "Values must be lock-free atomics");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Dirty words must be lock-free atomics");
+
+public:
+    using DeliverFn = void (*)(uint16_t index, T value, void* userData);
+
+    explicit ParameterMailbox(DeliverFn deliver = nullptr, void* userData = nullptr)
+        : deliver_(deliver), user_data_(userData) {}
+
+    ParameterMailbox(const ParameterMailbox&) = delete;
+    ParameterMailbox& operator=(const ParameterMailbox&) = delete;
+    ParameterMailbox(ParameterMailbox&&) = delete;
+    ParameterMailbox& operator=(ParameterMailbox&&) = delete;
+
+    /** Producer side: safe from ISRs and other threads. Out-of-range indices are ignored. */
+    void post(uint16_t index, T value) {
+        if (index >= N) return;
+        values_[index].store(value, std::memory_order_relaxed);
+        const size_t word = index >> 5;
+        // Value before dirty bit, dirty bit before summary: the drain acquires in reverse.
+        dirty_[word].fetch_or(1U << (index & 31U), std::memory_order_release);
+        summary_.fetch_or(1U << word, std::memory_order_release);
+        posts_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /** Consumer side: delivers every parameter posted since the last drain. */
+    size_t drain() {
+        uint32_t words = summary_.exchange(0, std::memory_order_acquire);
+        size_t count = 0;
+        while (words) {
+            const uint32_t word = static_cast<uint32_t>(__builtin_ctz(words));
+            words &= words - 1;
+            uint32_t bits = dirty_[word].exchange(0, std::memory_order_acquire);
+            while (bits) {
+                const uint32_t bit = static_cast<uint32_t>(__builtin_ctz(bits));
+                bits &= bits - 1;
+                const auto index = static_cast<uint16_t>(word * 32 + bit);
+                const T value = values_[index].load(std::memory_order_relaxed);
+                if (deliver_) deliver_(index, value, user_data_);
+                ++count;
+            }
+        }
+        if (count > 0) {
+            delivered_ += static_cast<uint32_t>(count);
+            ++drains_;
+        }
+        return count;
+    }
+
+    /** Bridge frame hook: userData is the ParameterMailbox. */
+    static void drainHook(void* userData) {
+        if (userData) static_cast<ParameterMailbox*>(userData)->drain();
+    }
+
+    /** Drains from Bridge::refresh(); the hook is removed on destruction. */
+    bool attach(Bridge& bridge) { return hook_.attach(bridge, &drainHook, this); }
+
+    /** Latest value posted, whether or not it was delivered. */
+    [[nodiscard]] T peek(uint16_t index) const {
+        return index < N ? values_[index].load(std::memory_order_relaxed) : T{};
+    }
+
+    [[nodiscard]] bool pending() const { return summary_.load(std::memory_order_relaxed) != 0; }
+
+    [[nodiscard]] ParameterMailboxStats stats() const {
+        ParameterMailboxStats stats{};
+        stats.posts = posts_.load(std::memory_order_relaxed);
+        stats.delivered = delivered_;
+        stats.drains = drains_;
+        return stats;
+    }
+
+    static constexpr size_t capacity() { return N; }
+
+private:
+    DeliverFn deliver_ = nullptr;
+    void* user_data_ = nullptr;
+    std::array<std::atomic<T>, N> values_{};
+    std::array<std::atomic<uint32_t>, WORDS> dirty_{};
+    std::atomic<uint32_t> summary_{0};
+    std::atomic<uint32_t> posts_{0};
+    uint32_t delivered_ = 0;
+    uint32_t drains_ = 0;
+    FrameHookRegistration hook_{};
+};
+
+}  // namespace oc::ui::lvgl
@@ -24,4 +24,8 @@ void PausableTimer::resume(bool ready) {
     if (ready) lv_timer_ready(timer_);
 }
 
+void PausableTimer::setPeriod(uint32_t periodMs) {
+    if (timer_) lv_timer_set_period(timer_, periodMs);
+}
+
 }  // namespace oc::ui::lvgl
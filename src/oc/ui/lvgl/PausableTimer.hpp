@@ -19,6 +19,7 @@ public:
 
     void pause();
     void resume(bool ready = false);
+    void setPeriod(uint32_t periodMs);
     [[nodiscard]] bool valid() const { return timer_ != nullptr; }
 
 private:
@@ -0,0 +1,115 @@
+#include "QuantizedValueBinding.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "ValueInvalidation.hpp"
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+constexpr int32_t PI_X1000 = 3142;
+
+}  // namespace
+
+QuantizedValueBinding::QuantizedValueBinding(const IWidget& widget, const QuantizedBindingConfig& config)
+    : widget_(widget), config_(config) {
+    resync();
+}
+
+QuantizedValueBinding::QuantizedValueBinding(const IWidget& widget, const QuantizedBindingConfig& config,
+                                             ApplyFn apply, void* userData)
+    : widget_(widget), config_(config), apply_(apply), user_data_(userData) {
+    resync();
+}
+
+void QuantizedValueBinding::resync() {
+    lv_obj_t* obj = object();
+    kind_ = Kind::Custom;
+    if (obj && !apply_) {
+        if (lv_obj_check_type(obj, &lv_arc_class)) {
+            kind_ = Kind::Arc;
+        } else if (lv_obj_check_type(obj, &lv_bar_class) || lv_obj_check_type(obj, &lv_slider_class)) {
+            kind_ = Kind::Bar;
+        }
+    }
+
+    steps_ = config_.steps > 0 ? config_.steps : pixelSteps();
+    // The widget's own range bounds what can be shown as well.
+    if (kind_ != Kind::Custom) {
+        const auto range = static_cast<uint32_t>(std::abs(widgetMax() - widgetMin())) + 1;
+        steps_ = std::min(steps_, range);
+    }
+    steps_ = std::max<uint32_t>(steps_, 1);
+    applied_step_ = -1;
+}
+
+bool QuantizedValueBinding::set(int32_t modelValue) {
+    ++stats_.updates;
+    lv_obj_t* obj = object();
+    if (!obj || (kind_ == Kind::Custom && !apply_)) return false;
+
+    const int32_t last = static_cast<int32_t>(steps_) - 1;
+    const int32_t clamped = std::clamp(modelValue, std::min(config_.modelMin, config_.modelMax),
+                                       std::max(config_.modelMin, config_.modelMax));
+    const int32_t step = config_.modelMin == config_.modelMax
+        ? 0
+        : lv_map(clamped, config_.modelMin, config_.modelMax, 0, last);
+    if (step == applied_step_) {
+        ++stats_.suppressed;
+        return false;
+    }
+    applied_step_ = step;
+    ++stats_.applied;
+
+    if (kind_ == Kind::Custom) {
+        apply_(obj, step, user_data_);
+        return true;
+    }
+
+    // Apply the step's representative value so equal steps render identically.
+    const int32_t value = last == 0 ? widgetMin() : lv_map(step, 0, last, widgetMin(), widgetMax());
+    if (kind_ == Kind::Arc) {
+        if (config_.minimalInvalidation) {
+            setArcValueMinimal(obj, value);
+        } else {
+            lv_arc_set_value(obj, value);
+        }
+    } else if (config_.minimalInvalidation) {
+        setBarValueMinimal(obj, value);
+    } else {
+        lv_bar_set_value(obj, value, LV_ANIM_OFF);
+    }
+    return true;
+}
+
+int32_t QuantizedValueBinding::widgetMin() const {
+    return kind_ == Kind::Arc ? lv_arc_get_min_value(object()) : lv_bar_get_min_value(object());
+}
+
+int32_t QuantizedValueBinding::widgetMax() const {
+    return kind_ == Kind::Arc ? lv_arc_get_max_value(object()) : lv_bar_get_max_value(object());
+}
+
+uint32_t QuantizedValueBinding::pixelSteps() const {
+    lv_obj_t* obj = object();
+    if (!obj) return 1;
+
+    if (kind_ == Kind::Arc) {
+        lv_obj_update_layout(obj);
+        const int32_t radius = std::min(lv_obj_get_content_width(obj), lv_obj_get_content_height(obj)) / 2;
+        int32_t sweep = static_cast<int32_t>(lv_arc_get_bg_angle_end(obj) - lv_arc_get_bg_angle_start(obj));
+        sweep = ((sweep % 360) + 360) % 360;
+        if (sweep == 0) sweep = 360;
+        return static_cast<uint32_t>(std::max<int32_t>(1, sweep * radius * PI_X1000 / (180 * 1000)));
+    }
+    if (kind_ == Kind::Bar) {
+        lv_obj_update_layout(obj);
+        return static_cast<uint32_t>(
+            std::max<int32_t>(1, std::max(lv_obj_get_content_width(obj), lv_obj_get_content_height(obj))));
+    }
+    return 1;
+}
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include "IWidget.hpp"
+
+namespace oc::ui::lvgl {
+
+struct QuantizedBindingStats {
+    uint32_t updates = 0;     ///< Model values received
+    uint32_t applied = 0;     ///< Updates that reached LVGL
+    uint32_t suppressed = 0;  ///< Updates that would not change a pixel
+};
+
+/**
+ * @brief Options of a QuantizedValueBinding
+ */
+struct QuantizedBindingConfig {
+    int32_t modelMin = 0;
+    int32_t modelMax = 16383;           ///< 14-bit parameters by default
+    uint32_t steps = 0;                 ///< Distinct rendered states; 0 derives them from pixels
+    bool minimalInvalidation = false;   ///< Apply through setArcValueMinimal/setBarValueMinimal
+};
+
+/**
+ * @brief Binds a model value to an arc, bar or slider at pixel resolution
+ *
+ * Model values are mapped to the widget range and quantized to the number of
+ * states the widget can actually draw: one per pixel of indicator travel for
+ * bars and sliders, one per pixel of arc length for arcs. LVGL is only called
+ * when the quantized state changes, so high-rate input (14-bit MIDI, encoder
+ * acceleration) does not invalidate widgets that would not move.
+ *
+ * Other widgets use an apply callback with an explicit steps count.
+ *
+ * @code
+ * QuantizedValueBinding cutoff(cutoffKnob, {.modelMax = 16383});
+ * void onParameter(uint16_t value) { cutoff.set(value); }  // mostly suppressed
+ * @endcode
+ */
+class QuantizedValueBinding {
+public:
+    using ApplyFn = void (*)(lv_obj_t* obj, int32_t step, void* userData);
+
+    QuantizedValueBinding(const IWidget& widget, const QuantizedBindingConfig& config = {});
+
+    /** Custom target: apply receives the quantized step (0..steps-1). */
+    QuantizedValueBinding(const IWidget& widget, const QuantizedBindingConfig& config,
+                          ApplyFn apply, void* userData);
+
+    /** @return true when the widget was updated */
+    bool set(int32_t modelValue);
+
+    /** Forces the next set() to apply, e.g. after the widget was rebuilt. */
+    void invalidate() { applied_step_ = -1; }
+
+    /** Recomputes the pixel resolution after the widget was resized or restyled. */
+    void resync();
+
+    [[nodiscard]] uint32_t steps() const { return steps_; }
+    [[nodiscard]] const QuantizedBindingStats& stats() const { return stats_; }
+
+private:
+    enum class Kind : uint8_t { Arc, Bar, Custom };
+
+    [[nodiscard]] lv_obj_t* object() const { return widget_.getElement(); }
+    [[nodiscard]] int32_t widgetMin() const;
+    [[nodiscard]] int32_t widgetMax() const;
+    [[nodiscard]] uint32_t pixelSteps() const;
+
+    const IWidget& widget_;
+    QuantizedBindingConfig config_;
+    ApplyFn apply_ = nullptr;
+    void* user_data_ = nullptr;
+    Kind kind_ = Kind::Custom;
+    uint32_t steps_ = 0;
+    int32_t applied_step_ = -1;
+    QuantizedBindingStats stats_{};
+};
+
+}  // namespace oc::ui::lvgl
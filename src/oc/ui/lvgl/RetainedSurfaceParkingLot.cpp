@@ -1,7 +1,17 @@
 #include "RetainedSurfaceParkingLot.hpp"
 
+#include "VisibilityEpoch.hpp"
+
 namespace oc::ui::lvgl {
 
+namespace {
+
+bool sameGeometry(const lv_area_t& a, const lv_area_t& b) {
+    return a.x1 == b.x1 && a.y1 == b.y1 && a.x2 == b.x2 && a.y2 == b.y2;
+}
+
+}  // namespace
+
 bool RetainedSurfaceParkingLot::initialize() {
     if (screen_) return true;
 
@@ -11,7 +21,22 @@ bool RetainedSurfaceParkingLot::initialize() {
 }
 
 RetainedSurfaceParkingLot::~RetainedSurfaceParkingLot() {
+    // Hosts outside the screen outlive the lot: stop watching them.
+    for (auto& keyed : hosts_) {
+        if (keyed.host) lv_obj_remove_event_cb_with_user_data(keyed.host, onHostDeleted, this);
+    }
+    for (auto& mirrored : mirrored_) {
+        if (mirrored.host) lv_obj_remove_event_cb_with_user_data(mirrored.host, onHostDeleted, this);
+    }
     if (!screen_) return;
+
+    // Parked managed trees die with the screen; let their owners know.
+    for (auto& entry : managed_) {
+        if (!entry.used || !entry.root) continue;
+        if (lv_obj_get_screen(entry.root) != screen_) continue;
+        entry.root = nullptr;
+        if (entry.surface.released) entry.surface.released(entry.surface.userData);
+    }
     lv_obj_delete(screen_);
     screen_ = nullptr;
 }
@@ -30,8 +55,7 @@ lv_obj_t* RetainedSurfaceParkingLot::createHost() const {
 }
 
 void RetainedSurfaceParkingLot::attach(lv_obj_t* root, lv_obj_t* parent) {
-    if (!root || !parent || lv_obj_get_parent(root) == parent) return;
-    lv_obj_set_parent(root, parent);
+    setObjectParent(root, parent);
 }
 
 void RetainedSurfaceParkingLot::park(lv_obj_t* root, lv_obj_t* host) {
@@ -54,4 +78,276 @@ void RetainedSurfaceParkingLot::mirrorViewport(lv_obj_t* host, lv_obj_t* sourceP
     lv_obj_set_size(host, width, height);
 }
 
+lv_obj_t* RetainedSurfaceParkingLot::hostFor(lv_obj_t* sourceParent) {
+    if (!screen_ || !sourceParent) return nullptr;
+
+    lv_area_t area{};
+    lv_obj_get_coords(sourceParent, &area);
+    KeyedHost* empty = nullptr;
+    for (auto& keyed : hosts_) {
+        if (keyed.host && sameGeometry(keyed.area, area)) return keyed.host;
+        if (!empty && !keyed.host) empty = &keyed;
+    }
+    if (!empty) return nullptr;
+
+    lv_obj_t* host = createHost();
+    if (!host) return nullptr;
+    mirrorViewport(host, sourceParent);
+    ++mirrors_;
+    track(*empty, host, area);
+    return host;
+}
+
+lv_obj_t* RetainedSurfaceParkingLot::parkKeyed(lv_obj_t* root) {
+    if (!root) return nullptr;
+
+    lv_obj_t* host = hostFor(lv_obj_get_parent(root));
+    parkInto(root, host);
+    return host;
+}
+
+ParkingLayoutStats RetainedSurfaceParkingLot::layoutStats() const {
+    ParkingLayoutStats stats{};
+    stats.parks = parks_;
+    stats.mirrors = mirrors_;
+    stats.layoutPassesSaved = mirrorsSkipped_;
+    for (const auto& keyed : hosts_) {
+        if (keyed.host) ++stats.keyedHosts;
+    }
+    return stats;
+}
+
+void RetainedSurfaceParkingLot::parkInto(lv_obj_t* root, lv_obj_t* host) {
+    if (!root || !host || lv_obj_get_parent(root) == host) return;
+
+    lv_obj_t* source = lv_obj_get_parent(root);
+    ++parks_;
+    if (!source) {
+        attach(root, host);
+        return;
+    }
+
+    // Parked screens are never laid out by the display, so host coordinates
+    // can be stale: compare against the geometry last mirrored into it.
+    lv_area_t sourceArea{};
+    lv_obj_get_coords(source, &sourceArea);
+    KeyedHost* record = mirrorRecord(host);
+    const bool known = record && record->host == host;
+
+    if (freezeLayout_ && known && sameGeometry(record->area, sourceArea)) {
+        ++mirrorsSkipped_;
+    } else {
+        mirrorViewport(host, source);
+        ++mirrors_;
+        if (known) {
+            record->area = sourceArea;
+        } else if (record) {
+            track(*record, host, sourceArea);
+        }
+    }
+    attach(root, host);
+}
+
+RetainedSurfaceParkingLot::KeyedHost* RetainedSurfaceParkingLot::mirrorRecord(lv_obj_t* host) {
+    for (auto& keyed : hosts_) {
+        if (keyed.host == host) return &keyed;
+    }
+    // Unkeyed hosts (managed surface hosts, user hosts) never serve hostFor().
+    KeyedHost* empty = nullptr;
+    for (auto& mirrored : mirrored_) {
+        if (mirrored.host == host) return &mirrored;
+        if (!empty && !mirrored.host) empty = &mirrored;
+    }
+    return empty;
+}
+
+void RetainedSurfaceParkingLot::track(KeyedHost& record, lv_obj_t* host, const lv_area_t& area) {
+    record = KeyedHost{host, area};
+    lv_obj_add_event_cb(host, onHostDeleted, LV_EVENT_DELETE, this);
+}
+
+void RetainedSurfaceParkingLot::onHostDeleted(lv_event_t* event) {
+    auto* lot = static_cast<RetainedSurfaceParkingLot*>(lv_event_get_user_data(event));
+    auto* host = static_cast<lv_obj_t*>(lv_event_get_current_target(event));
+    for (auto& keyed : lot->hosts_) {
+        if (keyed.host == host) keyed = KeyedHost{};
+    }
+    for (auto& mirrored : lot->mirrored_) {
+        if (mirrored.host == host) mirrored = KeyedHost{};
+    }
+}
+
+RetainedSurfaceParkingLot::SurfaceId RetainedSurfaceParkingLot::registerSurface(
+    const ManagedSurface& surface, lv_obj_t* root) {
+    if (!surface.host) return INVALID_SURFACE;
+
+    for (size_t i = 0; i < managed_.size(); ++i) {
+        Managed& entry = managed_[i];
+        if (entry.used) continue;
+
+        entry = Managed{surface, root, lv_tick_get(), true, false};
+        return static_cast<SurfaceId>(i);
+    }
+    return INVALID_SURFACE;
+}
+
+void RetainedSurfaceParkingLot::unregisterSurface(SurfaceId id) {
+    if (Managed* entry = managed(id)) *entry = Managed{};
+}
+
+lv_obj_t* RetainedSurfaceParkingLot::attachSurface(SurfaceId id, lv_obj_t* parent) {
+    Managed* entry = managed(id);
+    if (!entry || !parent) return nullptr;
+
+    if (entry->root && !entry->building) {
+        attach(entry->root, parent);
+    } else if (entry->building) {
+        // A prewarm was interrupted: complete it in place, then attach.
+        if (!finishBuild(*entry, entry->surface.host)) return nullptr;
+        attach(entry->root, parent);
+    } else if (!finishBuild(*entry, parent)) {
+        return nullptr;
+    }
+    entry->lastActivation = lv_tick_get();
+    return entry->root;
+}
+
+void RetainedSurfaceParkingLot::parkSurface(SurfaceId id) {
+    Managed* entry = managed(id);
+    if (!entry || !entry->root) return;
+
+    parkInto(entry->root, entry->surface.host);
+    (void)trim();
+}
+
+size_t RetainedSurfaceParkingLot::trim() {
+    size_t count = 0;
+    while (underPressure()) {
+        Managed* oldest = nullptr;
+        for (auto& entry : managed_) {
+            if (!entry.used || !entry.root) continue;
+            if (lv_obj_get_parent(entry.root) != entry.surface.host) continue;
+            if (!oldest || lv_tick_elaps(entry.lastActivation) > lv_tick_elaps(oldest->lastActivation)) {
+                oldest = &entry;
+            }
+        }
+        if (!oldest) break;
+
+        destroy(*oldest);
+        ++count;
+    }
+    return count;
+}
+
+lv_obj_t* RetainedSurfaceParkingLot::surfaceRoot(SurfaceId id) const {
+    return id < managed_.size() && managed_[id].used ? managed_[id].root : nullptr;
+}
+
+ManagedSurfaceStats RetainedSurfaceParkingLot::managedStats() const {
+    ManagedSurfaceStats stats{};
+    stats.destroyed = destroyed_;
+    stats.builds = builds_;
+    stats.abandoned = abandoned_;
+    for (const auto& entry : managed_) {
+        if (!entry.used) continue;
+        ++stats.registered;
+        if (!entry.root) continue;
+        ++stats.resident;
+        if (lv_obj_get_parent(entry.root) == entry.surface.host) {
+            ++stats.parked;
+            stats.parkedBytes += entry.surface.estimatedBytes;
+        }
+    }
+    return stats;
+}
+
+RetainedSurfaceParkingLot::Managed* RetainedSurfaceParkingLot::managed(SurfaceId id) {
+    if (id >= managed_.size() || !managed_[id].used) return nullptr;
+    return &managed_[id];
+}
+
+RetainedSurfaceParkingLot::PrewarmResult RetainedSurfaceParkingLot::prewarmStep(SurfaceId id) {
+    Managed* entry = managed(id);
+    if (!entry) return PrewarmResult::Failed;
+    if (entry->root && !entry->building) return PrewarmResult::Done;
+
+    const ManagedSurface& surface = entry->surface;
+    if (!surface.buildStep) {
+        return finishBuild(*entry, surface.host) ? PrewarmResult::Done : PrewarmResult::Failed;
+    }
+
+    bool done = false;
+    if (!nextBuildStep(*entry, surface.host, &done)) return PrewarmResult::Failed;
+    if (!entry->root) {
+        entry->building = !done;
+        return done ? PrewarmResult::Failed : PrewarmResult::Pending;
+    }
+    entry->building = !done;
+    if (!done) return PrewarmResult::Pending;
+
+    lv_obj_update_layout(entry->root);
+    entry->lastActivation = lv_tick_get();
+    ++builds_;
+    return PrewarmResult::Done;
+}
+
+bool RetainedSurfaceParkingLot::underPressure() const {
+    if (config_.maxParkedBytes > 0 && managedStats().parkedBytes > config_.maxParkedBytes) {
+        return true;
+    }
+    if (config_.minFreeHeapBytes > 0) {
+        lv_mem_monitor_t monitor{};
+        lv_mem_monitor(&monitor);
+        // Heaps that do not report usage leave total_size at 0.
+        if (monitor.total_size > 0 && monitor.free_size < config_.minFreeHeapBytes) return true;
+    }
+    return false;
+}
+
+bool RetainedSurfaceParkingLot::finishBuild(Managed& entry, lv_obj_t* parent) {
+    const ManagedSurface& surface = entry.surface;
+    if (surface.buildStep) {
+        bool done = false;
+        while (!done) {
+            if (!nextBuildStep(entry, parent, &done)) return false;
+        }
+    } else if (surface.build) {
+        entry.root = surface.build(parent, surface.userData);
+    }
+    entry.building = false;
+    if (!entry.root) return false;
+
+    lv_obj_update_layout(entry.root);
+    entry.lastActivation = lv_tick_get();
+    ++builds_;
+    return true;
+}
+
+bool RetainedSurfaceParkingLot::nextBuildStep(Managed& entry, lv_obj_t* parent, bool* done) {
+    if (!entry.building) entry.steps = 0;
+    if (entry.steps >= config_.maxBuildSteps) {
+        // A step that never completes would otherwise spin forever. The
+        // owner may hold pointers into the partial tree: tell it, as destroy() does.
+        if (entry.root) lv_obj_delete(entry.root);
+        entry.root = nullptr;
+        entry.building = false;
+        ++abandoned_;
+        if (entry.surface.released) entry.surface.released(entry.surface.userData);
+        return false;
+    }
+
+    ++entry.steps;
+    entry.building = true;
+    *done = entry.surface.buildStep(parent, &entry.root, entry.surface.userData);
+    return true;
+}
+
+void RetainedSurfaceParkingLot::destroy(Managed& entry) {
+    if (entry.root) lv_obj_delete(entry.root);
+    entry.root = nullptr;
+    entry.building = false;
+    ++destroyed_;
+    if (entry.surface.released) entry.surface.released(entry.surface.userData);
+}
+
 }  // namespace oc::ui::lvgl
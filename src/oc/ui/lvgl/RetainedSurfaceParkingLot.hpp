@@ -1,17 +1,75 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
 #include <lvgl.h>
 
 namespace oc::ui::lvgl {
 
+/** Builds a surface tree under parent and returns its root. */
+using SurfaceBuildFn = lv_obj_t* (*)(lv_obj_t* parent, void* userData);
+
+/**
+ * Builds part of a surface tree under parent. The first step stores the root;
+ * returns true once the tree is complete.
+ */
+using SurfaceBuildStepFn = bool (*)(lv_obj_t* parent, lv_obj_t** root, void* userData);
+
+/** Tells the owner its tree was destroyed; drop pointers into it. */
+using SurfaceReleaseFn = void (*)(void* userData);
+
+/** Registration of a surface whose parked tree may be destroyed and rebuilt. */
+struct ManagedSurface {
+    SurfaceBuildFn build = nullptr;
+    SurfaceReleaseFn released = nullptr;
+    void* userData = nullptr;
+    lv_obj_t* host = nullptr;      ///< Parking host from createHost()
+    size_t estimatedBytes = 0;     ///< Heap cost of the tree, used for maxParkedBytes
+    SurfaceBuildStepFn buildStep = nullptr;  ///< Optional chunked build, preferred by prewarming
+};
+
+/** Memory watermarks (0 disables a limit) and build bound for managed surfaces. */
+struct ManagedSurfaceConfig {
+    size_t minFreeHeapBytes = 0;   ///< Destroy parked trees while LVGL heap free is below
+    size_t maxParkedBytes = 0;     ///< Destroy parked trees while their estimated cost is above
+    uint16_t maxBuildSteps = 256;  ///< Chunked build steps before the build is abandoned
+};
+
+struct ManagedSurfaceStats {
+    uint8_t registered = 0;
+    uint8_t resident = 0;
+    uint8_t parked = 0;
+    size_t parkedBytes = 0;
+    uint32_t destroyed = 0;
+    uint32_t builds = 0;     ///< Trees built by attachSurface()
+    uint32_t abandoned = 0;  ///< Chunked builds stopped at maxBuildSteps
+};
+
+/** Keyed host and viewport mirroring counters. */
+struct ParkingLayoutStats {
+    uint8_t keyedHosts = 0;
+    uint32_t parks = 0;              ///< Parks through parkKeyed() or parkSurface()
+    uint32_t mirrors = 0;            ///< Host geometry updates (each relayouts the host)
+    uint32_t layoutPassesSaved = 0;  ///< Mirrors skipped by layout freeze
+};
+
 /**
  * Owns an off-screen LVGL screen used to park retained surface trees.
  *
  * Each geometry family should use its own host. park() mirrors the source
  * viewport before reparenting so percentage-sized roots keep reusable layout.
+ * hostFor() keeps one host per source geometry, and with layout freeze on,
+ * parkKeyed()/parkSurface() leave a host untouched when its geometry already
+ * matches the source, so the park costs no relayout.
  *
  * LVGL owns children through their parent. Destroy parked surface owners before
  * this parking lot, or attach those surfaces elsewhere before destruction.
+ *
+ * Managed surfaces trade memory for rebuild time: under a heap watermark the
+ * least recently activated parked trees are deleted, and attachSurface()
+ * rebuilds them. Their owners are told through ManagedSurface::released.
  */
 class RetainedSurfaceParkingLot {
 public:
@@ -30,10 +88,96 @@ public:
     static void attach(lv_obj_t* root, lv_obj_t* parent);
     static void park(lv_obj_t* root, lv_obj_t* host);
 
-private:
+    static constexpr size_t MAX_KEYED_HOSTS = 8;
+
+    /** Host shared by all sources with sourceParent's geometry, created on first use. */
+    [[nodiscard]] lv_obj_t* hostFor(lv_obj_t* sourceParent);
+
+    /** Parks root in the keyed host matching its current parent; returns that host. */
+    lv_obj_t* parkKeyed(lv_obj_t* root);
+
+    /** Skip mirroring when the host geometry already matches the source. */
+    void setLayoutFreeze(bool frozen) { freezeLayout_ = frozen; }
+    [[nodiscard]] ParkingLayoutStats layoutStats() const;
+
+    using SurfaceId = uint8_t;
+    static constexpr SurfaceId INVALID_SURFACE = 0xFF;
+    static constexpr size_t MAX_MANAGED_SURFACES = 16;
+
+    /**
+     * Registers a managed surface. root is its current tree, or nullptr to
+     * build it on first attach.
+     */
+    [[nodiscard]] SurfaceId registerSurface(const ManagedSurface& surface, lv_obj_t* root = nullptr);
+
+    /** Stops managing the surface; its tree, if any, is left where it is. */
+    void unregisterSurface(SurfaceId id);
+
+    /** Rebuilds the tree if it was destroyed, then attaches it to parent. */
+    lv_obj_t* attachSurface(SurfaceId id, lv_obj_t* parent);
+
+    /** Parks the tree in its host, then enforces the watermarks. */
+    void parkSurface(SurfaceId id);
+
+    /** Destroys least recently activated parked trees until within limits. */
+    size_t trim();
+
+    enum class PrewarmResult : uint8_t { Done, Pending, Failed };
+
+    /**
+     * Builds one chunk of a surface tree into its host. Done once the tree
+     * exists with its layout resolved; trees already built are Done.
+     */
+    PrewarmResult prewarmStep(SurfaceId id);
+
+    /** True when a watermark is exceeded (building more would be trimmed). */
+    [[nodiscard]] bool underPressure() const;
+
+    /** Sizes host like sourceParent so parked layout matches the live one. */
     static void mirrorViewport(lv_obj_t* host, lv_obj_t* sourceParent);
 
+    void configure(const ManagedSurfaceConfig& config) { config_ = config; }
+    [[nodiscard]] lv_obj_t* surfaceRoot(SurfaceId id) const;
+    [[nodiscard]] ManagedSurfaceStats managedStats() const;
+
+private:
+    struct Managed {
+        ManagedSurface surface{};
+        lv_obj_t* root = nullptr;
+        uint32_t lastActivation = 0;
+        bool used = false;
+        bool building = false;  ///< Chunked build in progress
+        uint16_t steps = 0;     ///< Steps taken by the current chunked build
+    };
+
+    struct KeyedHost {
+        lv_obj_t* host = nullptr;
+        lv_area_t area{};  ///< Source geometry the host mirrors
+    };
+
+    static constexpr size_t MAX_MIRRORED_HOSTS = MAX_MANAGED_SURFACES;
+
+    static void onHostDeleted(lv_event_t* event);
+    void track(KeyedHost& record, lv_obj_t* host, const lv_area_t& area);
+    KeyedHost* mirrorRecord(lv_obj_t* host);
+    void parkInto(lv_obj_t* root, lv_obj_t* host);
+    Managed* managed(SurfaceId id);
+    bool finishBuild(Managed& entry, lv_obj_t* parent);
+    bool nextBuildStep(Managed& entry, lv_obj_t* parent, bool* done);
+    void destroy(Managed& entry);
+
     lv_obj_t* screen_ = nullptr;
+    std::array<KeyedHost, MAX_KEYED_HOSTS> hosts_{};
+    std::array<KeyedHost, MAX_MIRRORED_HOSTS> mirrored_{};  ///< Other hosts parked into, for layout freeze
+    bool freezeLayout_ = false;
+    uint32_t parks_ = 0;
+    uint32_t mirrors_ = 0;
+    uint32_t mirrorsSkipped_ = 0;
+    std::array<Managed, MAX_MANAGED_SURFACES> managed_{};
+    ManagedSurfaceConfig config_{};
+    uint32_t destroyed_ = 0;
+    uint32_t builds_ = 0;
+    uint32_t abandoned_ = 0;
 };
 
 }  // namespace oc::ui::lvgl
@@ -0,0 +1,134 @@
+#include "RetainedSurfacePrewarmer.hpp"
+
+#include "MonotonicClock.hpp"
+
+namespace oc::ui::lvgl {
+
+RetainedSurfacePrewarmer::RetainedSurfacePrewarmer(RetainedSurfaceParkingLot& lot,
+                                                   const PrewarmConfig& config)
+    : lot_(lot), config_(config), timer_(config.periodMs, &RetainedSurfacePrewarmer::onTimer, this) {}
+
+bool RetainedSurfacePrewarmer::enqueue(SurfaceId id, uint8_t priority) {
+    if (id == RetainedSurfaceParkingLot::INVALID_SURFACE) return false;
+
+    Pending* slot = find(id);
+    if (!slot) {
+        slot = find(RetainedSurfaceParkingLot::INVALID_SURFACE);
+        if (!slot) return false;
+        *slot = Pending{id, priority, ++order_};
+    }
+    slot->priority = priority;
+    updateTimer();
+    return true;
+}
+
+void RetainedSurfacePrewarmer::setPriority(SurfaceId id, uint8_t priority) {
+    if (Pending* slot = find(id)) slot->priority = priority;
+}
+
+void RetainedSurfacePrewarmer::cancel(SurfaceId id) {
+    if (Pending* slot = find(id)) *slot = Pending{};
+    updateTimer();
+}
+
+void RetainedSurfacePrewarmer::clear() {
+    pending_.fill(Pending{});
+    updateTimer();
+}
+
+void RetainedSurfacePrewarmer::configure(const PrewarmConfig& config) {
+    config_ = config;
+    updateTimer();
+}
+
+bool RetainedSurfacePrewarmer::runSlice() {
+    const uint32_t start = monotonicMicros();
+    uint32_t elapsed = 0;
+    bool worked = false;
+
+    while (Pending* item = next()) {
+        if (lot_.underPressure()) {
+            ++stats_.deferredPressure;
+            break;
+        }
+
+        const auto result = lot_.prewarmStep(item->id);
+        ++stats_.steps;
+        worked = true;
+        if (result == RetainedSurfaceParkingLot::PrewarmResult::Done) {
+            ++stats_.prewarmed;
+            *item = Pending{};
+        } else if (result == RetainedSurfaceParkingLot::PrewarmResult::Failed) {
+            ++stats_.failed;
+            *item = Pending{};
+        }
+
+        elapsed = monotonicMicros() - start;
+        if (elapsed >= config_.budgetUs) break;
+    }
+
+    if (worked) {
+        ++stats_.slices;
+        if (elapsed > config_.budgetUs) ++stats_.overBudgetSlices;
+        if (elapsed > stats_.maxSliceUs) stats_.maxSliceUs = elapsed;
+    }
+    updateTimer();
+    return idle();
+}
+
+PrewarmStats RetainedSurfacePrewarmer::stats() const {
+    PrewarmStats stats = stats_;
+    stats.pending = pendingCount();
+    return stats;
+}
+
+void RetainedSurfacePrewarmer::onTimer(lv_timer_t* timer) {
+    auto* self = static_cast<RetainedSurfacePrewarmer*>(lv_timer_get_user_data(timer));
+    if (!self) return;
+
+    if (self->config_.minInactiveMs != 0
+        && lv_display_get_inactive_time(nullptr) < self->config_.minInactiveMs) {
+        ++self->stats_.deferredBusy;
+        return;
+    }
+    (void)self->runSlice();
+}
+
+RetainedSurfacePrewarmer::Pending* RetainedSurfacePrewarmer::find(SurfaceId id) {
+    for (auto& item : pending_) {
+        if (item.id == id) return &item;
+    }
+    return nullptr;
+}
+
+RetainedSurfacePrewarmer::Pending* RetainedSurfacePrewarmer::next() {
+    Pending* best = nullptr;
+    for (auto& item : pending_) {
+        if (item.id == RetainedSurfaceParkingLot::INVALID_SURFACE) continue;
+        if (!best || item.priority > best->priority
+            || (item.priority == best->priority && item.order < best->order)) {
+            best = &item;
+        }
+    }
+    return best;
+}
+
+uint8_t RetainedSurfacePrewarmer::pendingCount() const {
+    uint8_t count = 0;
+    for (const auto& item : pending_) {
+        if (item.id != RetainedSurfaceParkingLot::INVALID_SURFACE) ++count;
+    }
+    return count;
+}
+
+void RetainedSurfacePrewarmer::updateTimer() {
+    if (!timer_.valid()) return;
+    if (idle()) {
+        timer_.pause();
+    } else {
+        timer_.setPeriod(config_.periodMs);
+        timer_.resume();
+    }
+}
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include "PausableTimer.hpp"
+#include "RetainedSurfaceParkingLot.hpp"
+
+namespace oc::ui::lvgl {
+
+/** Pacing of background builds (0 disables the idle check). */
+struct PrewarmConfig {
+    uint32_t periodMs = 20;          ///< Timer period between build slices
+    uint32_t budgetUs = 3000;        ///< Build time allowed per slice
+    uint32_t minInactiveMs = 200;    ///< Required input inactivity before building
+};
+
+struct PrewarmStats {
+    uint8_t pending = 0;
+    uint32_t prewarmed = 0;          ///< Trees completed in the background
+    uint32_t steps = 0;              ///< Build chunks executed
+    uint32_t slices = 0;             ///< Timer ticks that built something
+    uint32_t deferredBusy = 0;       ///< Ticks skipped for recent input
+    uint32_t deferredPressure = 0;   ///< Ticks skipped because the lot is over a watermark
+    uint32_t failed = 0;
+    uint32_t overBudgetSlices = 0;   ///< Slices whose last chunk ran past budgetUs
+    uint32_t maxSliceUs = 0;
+};
+
+/**
+ * Builds parked managed surfaces ahead of use, one chunk at a time.
+ *
+ * Each timer tick runs build steps until the slice budget is spent, highest
+ * priority first, and only while input has been idle. Finished trees stay in
+ * their parking host with layout resolved, so attachSurface() only reparents.
+ * Surfaces with a buildStep are built incrementally; plain build callbacks run
+ * as one chunk. Size each host with mirrorViewport() before queueing.
+ */
+class RetainedSurfacePrewarmer {
+public:
+    using SurfaceId = RetainedSurfaceParkingLot::SurfaceId;
+
+    static constexpr size_t MAX_PENDING = RetainedSurfaceParkingLot::MAX_MANAGED_SURFACES;
+
+    explicit RetainedSurfacePrewarmer(RetainedSurfaceParkingLot& lot, const PrewarmConfig& config = {});
+
+    RetainedSurfacePrewarmer(const RetainedSurfacePrewarmer&) = delete;
+    RetainedSurfacePrewarmer& operator=(const RetainedSurfacePrewarmer&) = delete;
+    RetainedSurfacePrewarmer(RetainedSurfacePrewarmer&&) = delete;
+    RetainedSurfacePrewarmer& operator=(RetainedSurfacePrewarmer&&) = delete;
+
+    /** Queues a surface (or updates its priority); higher priority builds first. */
+    bool enqueue(SurfaceId id, uint8_t priority = 0);
+    void setPriority(SurfaceId id, uint8_t priority);
+    void cancel(SurfaceId id);
+    void clear();
+
+    /** Runs one slice now, ignoring the idle check. Returns true when the queue is empty. */
+    bool runSlice();
+
+    void configure(const PrewarmConfig& config);
+    [[nodiscard]] bool idle() const { return pendingCount() == 0; }
+    [[nodiscard]] PrewarmStats stats() const;
+
+private:
+    struct Pending {
+        SurfaceId id = RetainedSurfaceParkingLot::INVALID_SURFACE;
+        uint8_t priority = 0;
+        uint32_t order = 0;
+    };
+
+    static void onTimer(lv_timer_t* timer);
+    Pending* find(SurfaceId id);
+    Pending* next();
+    [[nodiscard]] uint8_t pendingCount() const;
+    void updateTimer();
+
+    RetainedSurfaceParkingLot& lot_;
+    PrewarmConfig config_;
+    PausableTimer timer_;
+    std::array<Pending, MAX_PENDING> pending_{};
+    uint32_t order_ = 0;
+    PrewarmStats stats_{};
+};
+
+}  // namespace oc::ui::lvgl
@@ -5,25 +5,30 @@
 #include <oc/core/input/Binding.hpp>
 
 #include "IElement.hpp"
+#include "VisibilityEpoch.hpp"
 
 namespace oc::ui::lvgl {
 
 /**
  * @brief Create IsActiveFn from LVGL object
  *
- * Returns a function that checks if the LVGL object exists and is not hidden.
+ * Returns a function that checks if the LVGL object exists and is shown.
  * Use this to create scoped bindings tied to view/component visibility.
  *
- * When the LVGL object is hidden (LV_OBJ_FLAG_HIDDEN), the binding
- * will be inactive and won't trigger callbacks.
+ * The binding is inactive while the object or any ancestor is hidden
+ * (LV_OBJ_FLAG_HIDDEN), while its tree is parked off-screen, and once the
+ * object is deleted. Ancestor results are cached per object and revalidated
+ * by the visibility epoch (see VisibilityEpoch.hpp), so a check costs a flag
+ * read and a root compare, and building the function does not allocate.
  *
  * @param obj LVGL object to track (typically from IView::getElement())
  * @return IsActiveFn that returns true when obj is visible
  */
 inline oc::type::IsActiveFn isActive(lv_obj_t* obj) {
-    return [obj]() {
-        return obj && !lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN);
-    };
+    VisibilityHandle handle = watchVisibility(obj);
+    if (handle.valid()) return handle;
+    // All slots in use: walk the ancestors on every check.
+    return [obj]() { return isObjectActive(obj); };
 }
 
 /**
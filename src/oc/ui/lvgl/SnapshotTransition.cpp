@@ -0,0 +1,208 @@
+#include "SnapshotTransition.hpp"
+
+#if LV_USE_SNAPSHOT
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+constexpr int32_t PROGRESS_END = 256;
+
+lv_obj_t* createImage(lv_obj_t* parent, const lv_draw_buf_t* snapshot, int32_t x, int32_t y) {
+    lv_obj_t* image = lv_image_create(parent);
+    if (!image) return nullptr;
+    lv_obj_add_flag(image, LV_OBJ_FLAG_IGNORE_LAYOUT);
+    lv_obj_remove_flag(image, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_remove_flag(image, LV_OBJ_FLAG_SCROLLABLE);
+    lv_image_set_src(image, snapshot);
+    lv_obj_set_pos(image, x, y);
+    return image;
+}
+
+}  // namespace
+
+SnapshotTransition::~SnapshotTransition() {
+    finish();
+}
+
+TransitionResult SnapshotTransition::start(lv_obj_t* outgoing, lv_obj_t* outgoingHost,
+                                           lv_obj_t* incoming, lv_obj_t* parent,
+                                           const TransitionConfig& config, TransitionDoneFn done,
+                                           void* userData) {
+    finish();
+    if (!outgoing || !outgoingHost || !incoming || !parent) return TransitionResult::Failed;
+
+    config_ = config;
+    lot_ = nullptr;
+    outgoingHost_ = outgoingHost;
+    done_ = done;
+    userData_ = userData;
+    return begin(outgoing, incoming, parent);
+}
+
+TransitionResult SnapshotTransition::start(RetainedSurfaceParkingLot& lot, SurfaceId outgoing,
+                                           SurfaceId incoming, lv_obj_t* parent,
+                                           const TransitionConfig& config, TransitionDoneFn done,
+                                           void* userData) {
+    finish();
+
+    using PrewarmResult = RetainedSurfaceParkingLot::PrewarmResult;
+    auto result = PrewarmResult::Pending;
+    for (uint16_t step = 0; result == PrewarmResult::Pending && step < config.maxPrepareSteps; ++step) {
+        result = lot.prewarmStep(incoming);
+    }
+    lv_obj_t* from = lot.surfaceRoot(outgoing);
+    if (!from || !parent) return TransitionResult::Failed;
+
+    if (result != PrewarmResult::Done) {
+        // Unprepared: no snapshot to take, so swap without animation.
+        if (!lot.attachSurface(incoming, parent)) return TransitionResult::Failed;
+        lot.parkSurface(outgoing);
+        ++stats_.transitions;
+        ++stats_.fallbacks;
+        if (done) done(userData);
+        return TransitionResult::Swapped;
+    }
+    lv_obj_t* to = lot.surfaceRoot(incoming);
+
+    config_ = config;
+    lot_ = &lot;
+    outgoingId_ = outgoing;
+    incomingId_ = incoming;
+    done_ = done;
+    userData_ = userData;
+    return begin(from, to, parent);
+}
+
+TransitionResult SnapshotTransition::begin(lv_obj_t* outgoing, lv_obj_t* incoming, lv_obj_t* parent) {
+    incoming_ = incoming;
+    parent_ = parent;
+    ++stats_.transitions;
+
+    outgoingSnapshot_ = lv_snapshot_take(outgoing, config_.format);
+    incomingSnapshot_ = outgoingSnapshot_ ? lv_snapshot_take(incoming, config_.format) : nullptr;
+    if (!incomingSnapshot_) {
+        ++stats_.fallbacks;
+        release();
+        swap(outgoing, incoming);
+        return TransitionResult::Swapped;
+    }
+    stats_.snapshotBytes = outgoingSnapshot_->data_size + incomingSnapshot_->data_size;
+
+    x_ = lv_obj_get_x(outgoing);
+    y_ = lv_obj_get_y(outgoing);
+    width_ = lv_obj_get_width(outgoing);
+    height_ = lv_obj_get_height(outgoing);
+
+    // Park first: from here on the parent only holds the two images.
+    if (lot_) {
+        lot_->parkSurface(outgoingId_);
+    } else {
+        RetainedSurfaceParkingLot::park(outgoing, outgoingHost_);
+    }
+
+    outgoingImage_ = createImage(parent, outgoingSnapshot_, x_, y_);
+    incomingImage_ = outgoingImage_ ? createImage(parent, incomingSnapshot_, x_, y_) : nullptr;
+    if (!incomingImage_) {
+        ++stats_.fallbacks;
+        finish();
+        return TransitionResult::Swapped;
+    }
+    apply(0);
+
+    lv_anim_t anim;
+    lv_anim_init(&anim);
+    lv_anim_set_var(&anim, this);
+    lv_anim_set_user_data(&anim, this);
+    lv_anim_set_exec_cb(&anim, &SnapshotTransition::onStep);
+    lv_anim_set_completed_cb(&anim, &SnapshotTransition::onCompleted);
+    lv_anim_set_values(&anim, 0, PROGRESS_END);
+    lv_anim_set_duration(&anim, config_.durationMs);
+    if (config_.path) lv_anim_set_path_cb(&anim, config_.path);
+    lv_anim_start(&anim);
+    return TransitionResult::Animated;
+}
+
+void SnapshotTransition::finish() {
+    if (!incoming_) return;
+
+    lv_anim_delete(this, &SnapshotTransition::onStep);
+    release();
+
+    if (lot_) {
+        (void)lot_->attachSurface(incomingId_, parent_);
+    } else {
+        RetainedSurfaceParkingLot::attach(incoming_, parent_);
+    }
+    incoming_ = nullptr;
+    parent_ = nullptr;
+    lot_ = nullptr;
+
+    TransitionDoneFn done = done_;
+    done_ = nullptr;
+    if (done) done(userData_);
+}
+
+void SnapshotTransition::swap(lv_obj_t* outgoing, lv_obj_t* incoming) {
+    if (lot_) {
+        lot_->parkSurface(outgoingId_);
+    } else {
+        RetainedSurfaceParkingLot::park(outgoing, outgoingHost_);
+    }
+    incoming_ = incoming;
+    finish();
+}
+
+void SnapshotTransition::apply(int32_t progress) {
+    const auto fraction = [progress](int32_t extent) { return extent * progress / PROGRESS_END; };
+
+    switch (config_.kind) {
+        case TransitionKind::Fade:
+            lv_obj_set_style_image_opa(incomingImage_, static_cast<lv_opa_t>(fraction(LV_OPA_COVER)), 0);
+            break;
+        case TransitionKind::SlideLeft:
+            lv_obj_set_x(outgoingImage_, x_ - fraction(width_));
+            lv_obj_set_x(incomingImage_, x_ + width_ - fraction(width_));
+            break;
+        case TransitionKind::SlideRight:
+            lv_obj_set_x(outgoingImage_, x_ + fraction(width_));
+            lv_obj_set_x(incomingImage_, x_ - width_ + fraction(width_));
+            break;
+        case TransitionKind::SlideUp:
+            lv_obj_set_y(outgoingImage_, y_ - fraction(height_));
+            lv_obj_set_y(incomingImage_, y_ + height_ - fraction(height_));
+            break;
+        case TransitionKind::SlideDown:
+            lv_obj_set_y(outgoingImage_, y_ + fraction(height_));
+            lv_obj_set_y(incomingImage_, y_ - height_ + fraction(height_));
+            break;
+    }
+}
+
+void SnapshotTransition::release() {
+    // Images reference the snapshots: delete them first.
+    if (incomingImage_) lv_obj_delete(incomingImage_);
+    if (outgoingImage_) lv_obj_delete(outgoingImage_);
+    incomingImage_ = nullptr;
+    outgoingImage_ = nullptr;
+
+    if (incomingSnapshot_) lv_draw_buf_destroy(incomingSnapshot_);
+    if (outgoingSnapshot_) lv_draw_buf_destroy(outgoingSnapshot_);
+    incomingSnapshot_ = nullptr;
+    outgoingSnapshot_ = nullptr;
+}
+
+void SnapshotTransition::onStep(void* var, int32_t progress) {
+    auto* self = static_cast<SnapshotTransition*>(var);
+    if (!self->running()) return;
+    ++self->stats_.frames;
+    self->apply(progress);
+}
+
+void SnapshotTransition::onCompleted(lv_anim_t* anim) {
+    static_cast<SnapshotTransition*>(lv_anim_get_user_data(anim))->finish();
+}
+
+}  // namespace oc::ui::lvgl
+
+#endif  // LV_USE_SNAPSHOT
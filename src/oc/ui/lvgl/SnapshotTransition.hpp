@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include "RetainedSurfaceParkingLot.hpp"
+
+#if LV_USE_SNAPSHOT
+
+namespace oc::ui::lvgl {
+
+enum class TransitionKind : uint8_t { Fade, SlideLeft, SlideRight, SlideUp, SlideDown };
+
+struct TransitionConfig {
+    TransitionKind kind = TransitionKind::SlideLeft;
+    uint32_t durationMs = 200;
+    lv_anim_path_cb_t path = lv_anim_path_ease_out;
+    lv_color_format_t format = LV_COLOR_FORMAT_NATIVE;
+    uint16_t maxPrepareSteps = 64;  ///< Incoming prewarm steps before swapping without animation
+};
+
+struct TransitionStats {
+    uint32_t transitions = 0;
+    uint32_t fallbacks = 0;        ///< Snapshot failed or incoming unprepared: views were swapped instantly
+    uint32_t frames = 0;           ///< Animation steps, each a blit of two images
+    uint32_t snapshotBytes = 0;    ///< Buffers held by the last transition
+};
+
+/// Outcome of SnapshotTransition::start().
+enum class TransitionResult : uint8_t {
+    Animated,  ///< Animation running; done is called when it ends
+    Swapped,   ///< Views swapped without animation; done was already called
+    Failed,    ///< Nothing changed; done is not called
+};
+
+/** Called once the incoming tree is live again. */
+using TransitionDoneFn = void (*)(void* userData);
+
+/**
+ * Transition between two retained views using snapshots taken once.
+ *
+ * The outgoing view and the incoming parked view are rendered into two draw
+ * buffers, the outgoing tree is parked, and two image objects are animated in
+ * their place. When the animation ends the images and buffers are freed and the
+ * incoming tree is attached, so intermediate frames never render widgets.
+ *
+ * The incoming tree must be built with layout resolved (parked or prewarmed).
+ * If a snapshot cannot be allocated the views are swapped without animation.
+ */
+class SnapshotTransition {
+public:
+    using SurfaceId = RetainedSurfaceParkingLot::SurfaceId;
+
+    SnapshotTransition() = default;
+    ~SnapshotTransition();
+
+    SnapshotTransition(const SnapshotTransition&) = delete;
+    SnapshotTransition& operator=(const SnapshotTransition&) = delete;
+    SnapshotTransition(SnapshotTransition&&) = delete;
+    SnapshotTransition& operator=(SnapshotTransition&&) = delete;
+
+    /**
+     * Transitions from the live outgoing tree to the parked incoming tree.
+     * outgoing is parked in outgoingHost; incoming is attached to parent.
+     * @return Failed for a null argument
+     */
+    TransitionResult start(lv_obj_t* outgoing, lv_obj_t* outgoingHost, lv_obj_t* incoming,
+                           lv_obj_t* parent, const TransitionConfig& config = {},
+                           TransitionDoneFn done = nullptr, void* userData = nullptr);
+
+    /**
+     * Same, for managed surfaces; the incoming tree is built first if needed.
+     * An incoming build not done within maxPrepareSteps is finished by
+     * attachSurface() and the views are swapped without animation.
+     * @return Failed if a surface is unknown or the incoming tree cannot be built
+     */
+    TransitionResult start(RetainedSurfaceParkingLot& lot, SurfaceId outgoing, SurfaceId incoming,
+                           lv_obj_t* parent, const TransitionConfig& config = {},
+                           TransitionDoneFn done = nullptr, void* userData = nullptr);
+
+    /** Jumps to the end state of a running transition. */
+    void finish();
+
+    [[nodiscard]] bool running() const { return outgoingImage_ != nullptr; }
+    [[nodiscard]] const TransitionStats& stats() const { return stats_; }
+
+private:
+    TransitionResult begin(lv_obj_t* outgoing, lv_obj_t* incoming, lv_obj_t* parent);
+    void swap(lv_obj_t* outgoing, lv_obj_t* incoming);
+    void apply(int32_t progress);
+    void release();
+
+    static void onStep(void* var, int32_t progress);
+    static void onCompleted(lv_anim_t* anim);
+
+    TransitionConfig config_{};
+    RetainedSurfaceParkingLot* lot_ = nullptr;
+    SurfaceId outgoingId_ = RetainedSurfaceParkingLot::INVALID_SURFACE;
+    SurfaceId incomingId_ = RetainedSurfaceParkingLot::INVALID_SURFACE;
+    lv_obj_t* outgoingHost_ = nullptr;
+    lv_obj_t* incoming_ = nullptr;
+    lv_obj_t* parent_ = nullptr;
+    lv_draw_buf_t* outgoingSnapshot_ = nullptr;
+    lv_draw_buf_t* incomingSnapshot_ = nullptr;
+    lv_obj_t* outgoingImage_ = nullptr;
+    lv_obj_t* incomingImage_ = nullptr;
+    int32_t x_ = 0;
+    int32_t y_ = 0;
+    int32_t width_ = 0;
+    int32_t height_ = 0;
+    TransitionDoneFn done_ = nullptr;
+    void* userData_ = nullptr;
+    TransitionStats stats_{};
+};
+
+}  // namespace oc::ui::lvgl
+
+#endif  // LV_USE_SNAPSHOT
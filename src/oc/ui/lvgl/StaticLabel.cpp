@@ -0,0 +1,97 @@
+#include "StaticLabel.hpp"
+
+#include "MonotonicClock.hpp"
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+/// Appends src to out at pos, keeping room for the terminator.
+size_t append(char* out, size_t capacity, size_t pos, const char* src) {
+    while (src && *src && pos + 1 < capacity) out[pos++] = *src++;
+    return pos;
+}
+
+size_t appendDigits(char* out, size_t capacity, size_t pos, uint32_t value, uint8_t minDigits) {
+    char digits[10];
+    uint8_t count = 0;
+    do {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0 && count < sizeof(digits));
+    while (count < minDigits && count < sizeof(digits)) digits[count++] = '0';
+    while (count > 0 && pos + 1 < capacity) out[pos++] = digits[--count];
+    return pos;
+}
+
+uint32_t magnitude(int32_t value) {
+    return value < 0 ? 0U - static_cast<uint32_t>(value) : static_cast<uint32_t>(value);
+}
+
+uint8_t fragPct() {
+    lv_mem_monitor_t monitor{};
+    lv_mem_monitor(&monitor);
+    return monitor.frag_pct;
+}
+
+}  // namespace
+
+size_t formatInteger(char* out, size_t capacity, int32_t value, const char* unit) {
+    if (!out || capacity == 0) return 0;
+    size_t pos = 0;
+    if (value < 0) pos = append(out, capacity, pos, "-");
+    pos = appendDigits(out, capacity, pos, magnitude(value), 1);
+    pos = append(out, capacity, pos, unit);
+    out[pos] = '\0';
+    return pos;
+}
+
+size_t formatFixed(char* out, size_t capacity, int32_t scaled, uint8_t decimals, const char* unit) {
+    if (!out || capacity == 0) return 0;
+    if (decimals == 0) return formatInteger(out, capacity, scaled, unit);
+    decimals = decimals > 9 ? 9 : decimals;
+
+    uint32_t divisor = 1;
+    for (uint8_t i = 0; i < decimals; ++i) divisor *= 10;
+
+    const uint32_t abs = magnitude(scaled);
+    size_t pos = 0;
+    if (scaled < 0) pos = append(out, capacity, pos, "-");
+    pos = appendDigits(out, capacity, pos, abs / divisor, 1);
+    pos = append(out, capacity, pos, ".");
+    pos = appendDigits(out, capacity, pos, abs % divisor, decimals);
+    pos = append(out, capacity, pos, unit);
+    out[pos] = '\0';
+    return pos;
+}
+
+LabelFormatBenchmark benchmarkLabelFormatting(lv_obj_t* label, uint32_t iterations) {
+    LabelFormatBenchmark result{};
+    if (!label || iterations == 0) return result;
+    result.iterations = iterations;
+    result.fragPctBefore = fragPct();
+
+    // Values alternate sign and width so every update changes the text.
+    auto valueAt = [](uint32_t i) { return static_cast<int32_t>((i * 7919U) % 20001U) - 10000; };
+
+    uint32_t start = monotonicMicros();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        lv_label_set_text_fmt(label, "%" LV_PRId32 " dB", valueAt(i));
+    }
+    uint32_t elapsed = monotonicMicros() - start;
+    result.fmtNsPerUpdate = static_cast<uint32_t>(static_cast<uint64_t>(elapsed) * 1000U / iterations);
+    result.fragPctAfterFmt = fragPct();
+
+    StaticLabel<16> text(label);
+    start = monotonicMicros();
+    for (uint32_t i = 0; i < iterations; ++i) {
+        text.setInteger(valueAt(i), " dB");
+    }
+    elapsed = monotonicMicros() - start;
+    result.staticNsPerUpdate = static_cast<uint32_t>(static_cast<uint64_t>(elapsed) * 1000U / iterations);
+    result.fragPctAfterStatic = fragPct();
+    text.detach();
+    return result;
+}
+
+}  // namespace oc::ui::lvgl
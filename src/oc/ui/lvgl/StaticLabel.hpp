@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <lvgl.h>
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief Write value followed by unit into out, without allocating
+ * @return Characters written (excluding the terminator); text is truncated to fit
+ */
+size_t formatInteger(char* out, size_t capacity, int32_t value, const char* unit = nullptr);
+
+/**
+ * @brief Write scaled / 10^decimals with exactly decimals digits (1234, 2 -> "12.34")
+ */
+size_t formatFixed(char* out, size_t capacity, int32_t scaled, uint8_t decimals,
+                   const char* unit = nullptr);
+
+/**
+ * @brief Numeric label text held in an inline buffer
+ *
+ * Formats into a fixed buffer owned by this object and hands it to LVGL with
+ * lv_label_set_text_static(), so updates never touch the LVGL heap. Text equal
+ * to the current one is not sent to LVGL at all.
+ *
+ * LVGL keeps a pointer to the buffer. A StaticLabel destroyed before its label
+ * detaches first (LVGL then takes its own copy), and a deleted label is
+ * forgotten.
+ *
+ * @code
+ * StaticLabel<12> gain(gainLabel);
+ * gain.setFixed(-35, 1, " dB");   // "-3.5 dB"
+ * @endcode
+ */
+template <size_t N = 16>
+class StaticLabel {
+    static_assert(N >= 2, "StaticLabel needs room for text");
+
+public:
+    explicit StaticLabel(lv_obj_t* label = nullptr) { attach(label); }
+    ~StaticLabel() { detach(); }
+
+    StaticLabel(const StaticLabel&) = delete;
+    StaticLabel& operator=(const StaticLabel&) = delete;
+    StaticLabel(StaticLabel&&) = delete;
+    StaticLabel& operator=(StaticLabel&&) = delete;
+
+    void attach(lv_obj_t* label) {
+        if (label == label_) return;
+        detach();
+        label_ = label;
+        if (!label_) return;
+        lv_obj_add_event_cb(label_, onLabelDeleted, LV_EVENT_DELETE, this);
+        lv_label_set_text_static(label_, text_);
+    }
+
+    /** Gives LVGL its own copy of the text and forgets the label. */
+    void detach() {
+        if (!label_) return;
+        lv_obj_remove_event_cb_with_user_data(label_, onLabelDeleted, this);
+        lv_label_set_text(label_, text_);
+        label_ = nullptr;
+    }
+
+    bool setText(const char* text) {
+        char next[N];
+        std::strncpy(next, text ? text : "", N - 1);
+        next[N - 1] = '\0';
+        return commit(next);
+    }
+
+    bool setInteger(int32_t value, const char* unit = nullptr) {
+        char next[N];
+        formatInteger(next, N, value, unit);
+        return commit(next);
+    }
+
+    bool setFixed(int32_t scaled, uint8_t decimals, const char* unit = nullptr) {
+        char next[N];
+        formatFixed(next, N, scaled, decimals, unit);
+        return commit(next);
+    }
+
+    [[nodiscard]] const char* text() const { return text_; }
+    [[nodiscard]] lv_obj_t* label() const { return label_; }
+
+private:
+    static void onLabelDeleted(lv_event_t* event) {
+        static_cast<StaticLabel*>(lv_event_get_user_data(event))->label_ = nullptr;
+    }
+
+    /** @return true when the text changed and the label was refreshed */
+    bool commit(const char* next) {
+        if (std::strcmp(next, text_) == 0) return false;
+        std::memcpy(text_, next, N);
+        // Same pointer: LVGL only re-measures the text, nothing is copied.
+        if (label_) lv_label_set_text_static(label_, text_);
+        return true;
+    }
+
+    lv_obj_t* label_ = nullptr;
+    char text_[N] = {};
+};
+
+/**
+ * @brief Cost of one numeric label update, lv_label_set_text_fmt versus StaticLabel
+ *
+ * Heap figures come from lv_mem_monitor() and stay 0 on heaps that do not
+ * report usage.
+ */
+struct LabelFormatBenchmark {
+    uint32_t iterations = 0;
+    uint32_t fmtNsPerUpdate = 0;
+    uint32_t staticNsPerUpdate = 0;
+    uint8_t fragPctBefore = 0;
+    uint8_t fragPctAfterFmt = 0;
+    uint8_t fragPctAfterStatic = 0;
+};
+
+/**
+ * @brief Update label with changing values both ways and time them
+ *
+ * The label is left showing the last static text and detached.
+ */
+LabelFormatBenchmark benchmarkLabelFormatting(lv_obj_t* label, uint32_t iterations = 1000);
+
+}  // namespace oc::ui::lvgl
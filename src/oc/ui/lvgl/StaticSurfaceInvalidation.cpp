@@ -1,24 +1,145 @@
 #include "StaticSurfaceInvalidation.hpp"
 
-// LVGL 9 keeps direct display invalidation private. This translation unit is
-// the only package boundary allowed to depend on that internal API.
+#include <array>
+
+// LVGL 9 keeps direct display invalidation private. Private LVGL headers are
+// confined to the boundary units listed in README.md.
 #include <src/core/lv_refr_private.h>
+#include <src/display/lv_display_private.h>
+
+#include "DirtyTileMap.hpp"
+#include "FrameInvalidation.hpp"
+#include "StaticSurfaceValidator.hpp"
 
 static_assert(LVGL_VERSION_MAJOR == 9,
               "Review direct invalidation for this LVGL major");
 
 namespace oc::ui::lvgl {
 
+namespace {
+
+#if OC_ENABLE_STATS
+StaticInvalidationStats g_stats{};
+#endif
+DirtyTileMap* g_tileMap = nullptr;
+
+struct RoutedTransaction {
+    lv_display_t* display = nullptr;
+    FrameInvalidation* frame = nullptr;
+};
+
+std::array<RoutedTransaction, MAX_FRAME_TRANSACTIONS> g_transactions{};
+
+}  // namespace
+
 void invalidateStaticSurfaceArea(lv_obj_t* clipObject,
                                  const lv_area_t& requested) {
     if (!clipObject) return;
 
     lv_display_t* display = lv_obj_get_display(clipObject);
-    if (!display || !lv_display_is_invalidation_enabled(display)) return;
+    if (!display) return;
+    if (FrameInvalidation* frame = staticSurfaceTransaction(display)) {
+        frame->include(clipObject, requested);
+        return;
+    }
+    if (!lv_display_is_invalidation_enabled(display)) {
+#if OC_ENABLE_STATS
+        ++g_stats.dropped;
+#endif
+        return;
+    }
 
     lv_area_t visible = requested;
     if (!lv_obj_area_is_visible(clipObject, &visible)) return;
-    (void)lv_inv_area(display, &visible);
+    invalidateStaticDisplayArea(display, visible, clipObject);
+}
+
+void invalidateStaticDisplayArea(lv_display_t* display, const lv_area_t& visible, lv_obj_t* clipObject) {
+    if (!display || !lv_display_is_invalidation_enabled(display)) return;
+
+    if (g_tileMap && g_tileMap->display() == display) {
+        g_tileMap->mark(visible);
+    } else {
+        (void)submitInvalidArea(display, visible);
+    }
+#if OC_UI_LVGL_STATIC_SURFACE_VALIDATION
+    noteStaticSurfaceArea(clipObject, visible);
+#else
+    (void)clipObject;
+#endif
+}
+
+uint32_t pendingInvalidAreaCount(lv_display_t* display) {
+    return display ? display->inv_p : 0;
+}
+
+bool submitInvalidArea(lv_display_t* display, const lv_area_t& area) {
+    if (!display) return false;
+
+    // On overflow LVGL restarts the list with a single full-screen area.
+    const uint32_t before = display->inv_p;
+    (void)lv_inv_area(display, &area);
+    const bool overflowed = display->inv_p < before;
+#if OC_ENABLE_STATS
+    if (overflowed) ++g_stats.overflows;
+#endif
+    return overflowed;
+}
+
+bool setStaticSurfaceTransaction(lv_display_t* display, FrameInvalidation* frame) {
+    if (!display) return false;
+
+    RoutedTransaction* empty = nullptr;
+    for (auto& routed : g_transactions) {
+        if (routed.display == display) {
+            routed = frame ? RoutedTransaction{display, frame} : RoutedTransaction{};
+            return true;
+        }
+        if (!empty && !routed.display) empty = &routed;
+    }
+    if (!frame) return true;
+    if (!empty) return false;
+    *empty = RoutedTransaction{display, frame};
+    return true;
+}
+
+FrameInvalidation* staticSurfaceTransaction(lv_display_t* display) {
+    for (const auto& routed : g_transactions) {
+        if (routed.display && routed.display == display) return routed.frame;
+    }
+    return nullptr;
+}
+
+bool setStaticSurfaceTileMap(lv_display_t* display, DirtyTileMap* map) {
+    if (map && g_tileMap && g_tileMap != map) return false;
+    if (!map && g_tileMap && g_tileMap->display() && g_tileMap->display() != display) return false;
+    g_tileMap = map;
+    return true;
 }
 
+#if OC_ENABLE_STATS
+void recordStaticInvalidationBatch(const InvalidationRegionStats& regions, std::size_t submitted) {
+    ++g_stats.batches;
+    g_stats.submitted += static_cast<uint32_t>(submitted);
+    g_stats.regions.regions += regions.regions;
+    g_stats.regions.folded += regions.folded;
+    g_stats.regions.merged += regions.merged;
+    g_stats.regions.wastedPixels += regions.wastedPixels;
+}
+
+StaticInvalidationStats staticInvalidationStats() {
+    return g_stats;
+}
+
+void resetStaticInvalidationStats() {
+    g_stats = {};
+}
+#else
+StaticInvalidationStats staticInvalidationStats() {
+    return {};
+}
+
+void resetStaticInvalidationStats() {}
+#endif
+
 }  // namespace oc::ui::lvgl
@@ -1,29 +1,95 @@
 #pragma once
 
-#include <algorithm>
-#include <array>
 #include <cstddef>
+#include <cstdint>
 
 #include <lvgl.h>
 
+#include <oc/Config.hpp>
+
+#include "InvalidationRegions.hpp"
+
 namespace oc::ui::lvgl {
 
+class DirtyTileMap;
+class FrameInvalidation;
+
 /**
  * Invalidates an exact area of a static, effect-free object.
  *
  * The object must not draw outside its coordinates through shadows, blur, or
  * overflow effects. Use normal LVGL invalidation when that contract is false.
+ * While a FrameInvalidation transaction is open on the object's display, the
+ * area is included in it instead.
  */
 void invalidateStaticSurfaceArea(lv_obj_t* clipObject,
                                  const lv_area_t& requested);
 
+/** Areas LVGL holds for the display's next refresh (0 when none are pending). */
+[[nodiscard]] uint32_t pendingInvalidAreaCount(lv_display_t* display);
+
+/**
+ * Invalidates area on display directly.
+ * @return true if LVGL ran out of area slots and fell back to a full redraw
+ */
+bool submitInvalidArea(lv_display_t* display, const lv_area_t& area);
+
+/**
+ * Routes invalidateStaticSurfaceArea() on display to map (nullptr restores
+ * direct invalidation). Fails while another display has a map.
+ */
+bool setStaticSurfaceTileMap(lv_display_t* display, DirtyTileMap* map);
+
+/// Displays that can have a FrameInvalidation transaction open at once.
+inline constexpr std::size_t MAX_FRAME_TRANSACTIONS = 4;
+
+/**
+ * Routes invalidateStaticSurfaceArea() on display into frame (nullptr ends
+ * routing). Called by FrameInvalidation::begin() and commit(); fails when
+ * MAX_FRAME_TRANSACTIONS other displays are routed.
+ */
+bool setStaticSurfaceTransaction(lv_display_t* display, FrameInvalidation* frame);
+
+/** Open transaction routed for display, or nullptr. */
+[[nodiscard]] FrameInvalidation* staticSurfaceTransaction(lv_display_t* display);
+
+/**
+ * Invalidates an area already clipped to the visible part of clipObject,
+ * through the display's DirtyTileMap when one is attached.
+ */
+void invalidateStaticDisplayArea(lv_display_t* display, const lv_area_t& visible,
+                                 lv_obj_t* clipObject = nullptr);
+
+/** Region counters accumulated over all flushed batches (zero without OC_ENABLE_STATS). */
+struct StaticInvalidationStats {
+    uint32_t batches = 0;
+    uint32_t submitted = 0;        ///< Regions passed to LVGL after merging
+    uint32_t overflows = 0;        ///< Submissions that forced a full redraw
+    uint32_t dropped = 0;          ///< Areas requested while invalidation was paused outside a transaction
+    InvalidationRegionStats regions{};
+};
+
+#if OC_ENABLE_STATS
+/** Called by StaticSurfaceInvalidationBatch::flush(). */
+void recordStaticInvalidationBatch(const InvalidationRegionStats& regions, std::size_t submitted);
+#endif
+
+[[nodiscard]] StaticInvalidationStats staticInvalidationStats();
+void resetStaticInvalidationStats();
+
 /**
  * Batches mutations for a static, effect-free LVGL surface.
  *
  * While this scope owns the display invalidation pause, all invalidations on
- * that display are suppressed. Keep scopes synchronous and narrow, include
- * every affected region, and never call user callbacks from inside a batch.
+ * that display are suppressed. Inside a FrameInvalidation transaction opened
+ * with suppress = true the display is already paused: the batch pauses
+ * nothing itself and its regions go to the transaction. With suppress = false
+ * the batch pauses as usual and flush() hands its regions to the transaction.
+ * Keep scopes synchronous and narrow, include every affected region, and
+ * never call user callbacks from inside a batch.
  * Include regions before and after mutations that can change geometry.
+ * Beyond MaxRegions disjoint regions, the cheapest pair (fewest extra pixels)
+ * is merged; see InvalidationRegionSet.
  */
 template <std::size_t MaxRegions = 16>
 class StaticSurfaceInvalidationBatch {
@@ -33,9 +99,12 @@ public:
     explicit StaticSurfaceInvalidationBatch(lv_obj_t* clipObject, bool enabled = true)
         : clip_object_(clipObject)
         , display_(enabled && clipObject ? lv_obj_get_display(clipObject) : nullptr) {
-        if (display_ && lv_display_is_invalidation_enabled(display_)) {
+        if (!display_) return;
+        if (lv_display_is_invalidation_enabled(display_)) {
             lv_display_enable_invalidation(display_, false);
             owns_pause_ = true;
+        } else {
+            routed_ = staticSurfaceTransaction(display_) != nullptr;
         }
     }
 
@@ -47,58 +116,44 @@ public:
     StaticSurfaceInvalidationBatch& operator=(const StaticSurfaceInvalidationBatch&) = delete;
 
     void include(lv_obj_t* object) {
-        if (!owns_pause_ || !object) return;
+        if (!collecting() || !object) return;
         lv_area_t area{};
         lv_obj_get_coords(object, &area);
         include(area);
     }
 
     void include(const lv_area_t& area) {
-        if (!owns_pause_) return;
-
-        if (collapsed_) {
-            join(regions_[0], area);
-            return;
-        }
-        if (region_count_ < regions_.size()) {
-            regions_[region_count_++] = area;
-            return;
-        }
-
-        for (std::size_t i = 1; i < region_count_; ++i) {
-            join(regions_[0], regions_[i]);
-        }
-        join(regions_[0], area);
-        region_count_ = 1;
-        collapsed_ = true;
+        if (!collecting()) return;
+        regions_.add(area);
     }
 
     void flush() {
-        if (!owns_pause_) return;
+        if (!collecting()) return;
 
-        lv_display_enable_invalidation(display_, true);
-        owns_pause_ = false;
-        for (std::size_t i = 0; i < region_count_; ++i) {
-            invalidateStaticSurfaceArea(clip_object_, regions_[i]);
+        if (owns_pause_) {
+            lv_display_enable_invalidation(display_, true);
+            owns_pause_ = false;
         }
-        region_count_ = 0;
-        collapsed_ = false;
+        routed_ = false;
+        for (const lv_area_t& area : regions_) {
+            invalidateStaticSurfaceArea(clip_object_, area);
+        }
+#if OC_ENABLE_STATS
+        recordStaticInvalidationBatch(regions_.stats(), regions_.size());
+#endif
+        regions_.clear();
     }
 
+    [[nodiscard]] const InvalidationRegionStats& regionStats() const { return regions_.stats(); }
+
 private:
-    static void join(lv_area_t& target, const lv_area_t& next) {
-        target.x1 = std::min(target.x1, next.x1);
-        target.y1 = std::min(target.y1, next.y1);
-        target.x2 = std::max(target.x2, next.x2);
-        target.y2 = std::max(target.y2, next.y2);
-    }
+    [[nodiscard]] bool collecting() const { return owns_pause_ || routed_; }
 
     lv_obj_t* clip_object_ = nullptr;
     lv_display_t* display_ = nullptr;
-    std::array<lv_area_t, MaxRegions> regions_{};
-    std::size_t region_count_ = 0;
+    InvalidationRegionSet<MaxRegions> regions_{};
     bool owns_pause_ = false;
-    bool collapsed_ = false;
+    bool routed_ = false;  ///< Regions go to an open FrameInvalidation
 };
 
 }  // namespace oc::ui::lvgl
@@ -0,0 +1,187 @@
+#include "StaticSurfaceValidator.hpp"
+
+#if OC_UI_LVGL_STATIC_SURFACE_VALIDATION
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "InvalidationRegions.hpp"
+#include "StaticSurfaceInvalidation.hpp"
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+constexpr int32_t TILE = 16;
+constexpr size_t MAX_DECLARED = 64;
+constexpr size_t MAX_REPORTED = 8;
+constexpr int32_t DECLARED_MARGIN = 8;  ///< Reach of shadows and outlines past a declared area
+
+struct Declared {
+    lv_obj_t* clipObject = nullptr;
+    lv_area_t area{};
+};
+
+struct Tile {
+    uint32_t pixels = 0;
+    lv_area_t bounds{};
+};
+
+std::array<Declared, MAX_DECLARED> g_declared{};
+size_t g_declaredCount = 0;
+bool g_active = false;
+StaticSurfaceViolationFn g_fn = nullptr;
+void* g_userData = nullptr;
+StaticSurfaceValidationStats g_stats{};
+bool g_warnedMode = false;
+
+void logViolation(const StaticSurfaceViolation& violation, void*) {
+    std::fprintf(stderr,
+                 "[static-surface] frame %u: %u stale px in (%d,%d)-(%d,%d), object %p, declared by %p\n",
+                 static_cast<unsigned>(violation.frame), static_cast<unsigned>(violation.pixels),
+                 static_cast<int>(violation.area.x1), static_cast<int>(violation.area.y1),
+                 static_cast<int>(violation.area.x2), static_cast<int>(violation.area.y2),
+                 static_cast<void*>(violation.object), static_cast<void*>(violation.declaredBy));
+}
+
+bool containsPoint(const lv_area_t& area, int32_t x, int32_t y) {
+    return x >= area.x1 && x <= area.x2 && y >= area.y1 && y <= area.y2;
+}
+
+/// Topmost, deepest visible object containing the point.
+lv_obj_t* objectAt(lv_obj_t* parent, int32_t x, int32_t y) {
+    const uint32_t count = lv_obj_get_child_count(parent);
+    for (uint32_t i = count; i > 0; --i) {
+        lv_obj_t* child = lv_obj_get_child(parent, static_cast<int32_t>(i - 1));
+        if (!child || lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN)) continue;
+
+        lv_area_t coords{};
+        lv_obj_get_coords(child, &coords);
+        if (containsPoint(coords, x, y)) return objectAt(child, x, y);
+    }
+    return parent;
+}
+
+lv_obj_t* declaredNear(const lv_area_t& area) {
+    for (size_t i = 0; i < g_declaredCount; ++i) {
+        lv_area_t reach = g_declared[i].area;
+        reach.x1 -= DECLARED_MARGIN;
+        reach.y1 -= DECLARED_MARGIN;
+        reach.x2 += DECLARED_MARGIN;
+        reach.y2 += DECLARED_MARGIN;
+        if (detail::areaPixels(detail::areaIntersection(reach, area)) > 0) return g_declared[i].clipObject;
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+void startStaticSurfaceValidation(StaticSurfaceViolationFn fn, void* userData) {
+    g_active = true;
+    g_fn = fn ? fn : logViolation;
+    g_userData = userData;
+    g_declaredCount = 0;
+}
+
+void stopStaticSurfaceValidation() {
+    g_active = false;
+    g_declaredCount = 0;
+}
+
+bool isValidatingStaticSurfaces() {
+    return g_active;
+}
+
+void noteStaticSurfaceArea(lv_obj_t* clipObject, const lv_area_t& area) {
+    if (!g_active || g_declaredCount >= g_declared.size()) return;
+    g_declared[g_declaredCount++] = Declared{clipObject, area};
+}
+
+size_t verifyStaticSurfaceFrame(lv_display_t* display, const uint8_t* frame, uint32_t stride) {
+    if (!g_active || !display || !frame) return 0;
+    ++g_stats.frames;
+
+    if (lv_display_get_render_mode(display) != LV_DISPLAY_RENDER_MODE_DIRECT) {
+        ++g_stats.unsupported;
+        if (!g_warnedMode) {
+            std::fprintf(stderr, "[static-surface] validation needs LV_DISPLAY_RENDER_MODE_DIRECT\n");
+            g_warnedMode = true;
+        }
+        return 0;
+    }
+
+    struct ClearDeclared {
+        ~ClearDeclared() { g_declaredCount = 0; }
+    } clearDeclared;
+
+    // Objects changed after the render: the shadow would show the next frame.
+    lv_obj_t* screen = lv_display_get_screen_active(display);
+    if (!screen || pendingInvalidAreaCount(display) > 0) {
+        ++g_stats.skipped;
+        return 0;
+    }
+
+    lv_draw_buf_t* shadow = lv_snapshot_take(screen, LV_COLOR_FORMAT_RGB565);
+    if (!shadow) {
+        ++g_stats.skipped;
+        return 0;
+    }
+    ++g_stats.verified;
+
+    const int32_t width = std::min<int32_t>(lv_display_get_horizontal_resolution(display), shadow->header.w);
+    const int32_t height = std::min<int32_t>(lv_display_get_vertical_resolution(display), shadow->header.h);
+    const int32_t tilesX = (width + TILE - 1) / TILE;
+    const int32_t tilesY = (height + TILE - 1) / TILE;
+    std::vector<Tile> tiles(static_cast<size_t>(tilesX) * static_cast<size_t>(tilesY));
+
+    for (int32_t y = 0; y < height; ++y) {
+        const auto* presented = reinterpret_cast<const uint16_t*>(frame + static_cast<size_t>(y) * stride);
+        const auto* expected =
+            reinterpret_cast<const uint16_t*>(shadow->data + static_cast<size_t>(y) * shadow->header.stride);
+        if (std::memcmp(presented, expected, static_cast<size_t>(width) * sizeof(uint16_t)) == 0) continue;
+
+        for (int32_t x = 0; x < width; ++x) {
+            if (presented[x] == expected[x]) continue;
+            Tile& tile = tiles[static_cast<size_t>(y / TILE) * tilesX + x / TILE];
+            if (tile.pixels++ == 0) {
+                tile.bounds = {x, y, x, y};
+            } else {
+                tile.bounds = detail::areaUnion(tile.bounds, {x, y, x, y});
+            }
+        }
+    }
+    lv_draw_buf_destroy(shadow);
+
+    InvalidationRegionSet<MAX_REPORTED> regions;
+    for (const Tile& tile : tiles) {
+        if (tile.pixels) regions.add(tile.bounds);
+    }
+
+    const uint32_t frameIndex = g_stats.frames;
+    for (const lv_area_t& area : regions) {
+        StaticSurfaceViolation violation{};
+        violation.area = area;
+        violation.frame = frameIndex;
+        for (const Tile& tile : tiles) {
+            if (tile.pixels && detail::areaContains(area, tile.bounds)) violation.pixels += tile.pixels;
+        }
+        violation.object = objectAt(screen, (area.x1 + area.x2) / 2, (area.y1 + area.y2) / 2);
+        violation.declaredBy = declaredNear(area);
+
+        ++g_stats.violations;
+        g_stats.stalePixels += violation.pixels;
+        g_fn(violation, g_userData);
+    }
+    return regions.size();
+}
+
+StaticSurfaceValidationStats staticSurfaceValidationStats() {
+    return g_stats;
+}
+
+}  // namespace oc::ui::lvgl
+
+#endif  // OC_UI_LVGL_STATIC_SURFACE_VALIDATION
@@ -0,0 +1,103 @@
+#pragma once
+
+/**
+ * @file StaticSurfaceValidator.hpp
+ * @brief Host-side check of the static-surface invalidation contract
+ *
+ * invalidateStaticSurfaceArea() and StaticSurfaceInvalidationBatch redraw only
+ * the declared areas. An object that draws outside them (shadow, blur,
+ * overflow) or a change left out of a batch leaves stale pixels behind.
+ *
+ * With OC_UI_LVGL_STATIC_SURFACE_VALIDATION=1 (host builds, LV_USE_SNAPSHOT),
+ * Bridge re-renders the active screen into a shadow buffer after each frame
+ * and compares it with the partially refreshed frame buffer. Differing pixels
+ * are reported as violations, with the deepest object under them and the clip
+ * object of the nearest declared area.
+ *
+ * @code
+ * oc::ui::lvgl::startStaticSurfaceValidation();   // logs to stderr
+ * runScenes();
+ * assert(oc::ui::lvgl::staticSurfaceValidationStats().violations == 0);
+ * @endcode
+ *
+ * Only DIRECT render mode can be validated: FULL redraws the whole screen on
+ * any invalidation, so stale pixels cannot occur, and PARTIAL keeps no
+ * complete frame. Frames in those modes are counted as unsupported and logged
+ * once. Frames are skipped while invalidations are pending (the screen
+ * changed after the frame was rendered). The top and system layers are not
+ * part of the shadow render; keep them empty while validating.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+#ifndef OC_UI_LVGL_STATIC_SURFACE_VALIDATION
+#define OC_UI_LVGL_STATIC_SURFACE_VALIDATION 0
+#endif
+
+#if OC_UI_LVGL_STATIC_SURFACE_VALIDATION
+#ifdef ARDUINO
+#error "OC_UI_LVGL_STATIC_SURFACE_VALIDATION is for host builds"
+#endif
+#if !LV_USE_SNAPSHOT
+#error "OC_UI_LVGL_STATIC_SURFACE_VALIDATION requires LV_USE_SNAPSHOT"
+#endif
+#endif
+
+namespace oc::ui::lvgl {
+
+#if OC_UI_LVGL_STATIC_SURFACE_VALIDATION
+
+/**
+ * @brief Stale pixels found in one frame
+ */
+struct StaticSurfaceViolation {
+    lv_area_t area{};                ///< Bounds of the stale pixels (tile aligned)
+    uint32_t pixels = 0;             ///< Pixels that differ from a full render
+    lv_obj_t* object = nullptr;      ///< Deepest visible object under the area
+    lv_obj_t* declaredBy = nullptr;  ///< Clip object of a nearby declared area, if any
+    uint32_t frame = 0;
+};
+
+struct StaticSurfaceValidationStats {
+    uint32_t frames = 0;       ///< Frames presented while validating
+    uint32_t verified = 0;     ///< Frames compared against a full render
+    uint32_t skipped = 0;      ///< Pending invalidation or no shadow buffer
+    uint32_t unsupported = 0;  ///< Frames in FULL or PARTIAL render mode
+    uint32_t violations = 0;
+    uint64_t stalePixels = 0;
+};
+
+using StaticSurfaceViolationFn = void (*)(const StaticSurfaceViolation& violation, void* userData);
+
+/**
+ * @brief Start validating frames; violations go to fn, or to stderr if null
+ */
+void startStaticSurfaceValidation(StaticSurfaceViolationFn fn = nullptr, void* userData = nullptr);
+
+void stopStaticSurfaceValidation();
+
+[[nodiscard]] bool isValidatingStaticSurfaces();
+
+/**
+ * @brief Record a declared area for the next frame (called by invalidateStaticSurfaceArea)
+ */
+void noteStaticSurfaceArea(lv_obj_t* clipObject, const lv_area_t& area);
+
+/**
+ * @brief Compare a presented RGB565 frame with a full render of the active screen
+ *
+ * Called by Bridge::refresh() after a frame was flushed. Frames of displays
+ * not in DIRECT render mode are not compared.
+ *
+ * @return Number of violations reported
+ */
+size_t verifyStaticSurfaceFrame(lv_display_t* display, const uint8_t* frame, uint32_t stride);
+
+[[nodiscard]] StaticSurfaceValidationStats staticSurfaceValidationStats();
+
+#endif  // OC_UI_LVGL_STATIC_SURFACE_VALIDATION
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,194 @@
+#include "StylePool.hpp"
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+/// Local styles handled per object in one pass.
+constexpr size_t MAX_LOCAL_PER_OBJECT = 8;
+
+/// Order-independent: styles list the same properties in any order.
+uint32_t hashProps(const StyleProperty* props, size_t count) {
+    uint32_t hash = static_cast<uint32_t>(count);
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t h = (static_cast<uint32_t>(props[i].prop) + 1U) * 0x9E3779B1U;
+        h ^= styleValueHash(props[i].prop, props[i].value) * 0x85EBCA77U;
+        hash += h ^ (h >> 15);
+    }
+    return hash;
+}
+
+bool sameProps(const StyleProperty* a, size_t countA, const StyleProperty* b, size_t countB) {
+    if (countA != countB) return false;
+    for (size_t i = 0; i < countA; ++i) {
+        bool found = false;
+        for (size_t j = 0; j < countB && !found; ++j) {
+            found = a[i].prop == b[j].prop && sameStyleValue(a[i].prop, a[i].value, b[j].value);
+        }
+        if (!found) return false;
+    }
+    return true;
+}
+
+void addReport(const lv_obj_t* obj, LocalStyleReport& report) {
+    ++report.objects;
+    const size_t styles = objectStyleCount(obj);
+    for (size_t i = 0; i < styles; ++i) {
+        ObjectStyleEntry entry{};
+        if (!objectStyleEntry(obj, i, &entry) || entry.transition) continue;
+        if (entry.local) {
+            ++report.localStyles;
+            report.localBytes += sizeof(lv_style_t) + styleStorageBytes(entry.style) + objectStyleEntryBytes();
+        } else {
+            ++report.sharedEntries;
+            report.sharedEntryBytes += objectStyleEntryBytes();
+        }
+    }
+
+    const uint32_t children = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < children; ++i) {
+        addReport(lv_obj_get_child(obj, static_cast<int32_t>(i)), report);
+    }
+}
+
+}  // namespace
+
+StylePool::~StylePool() {
+    for (size_t i = 0; i < owned_.size(); ++i) {
+        if (ownedUsed_[i]) lv_style_reset(&owned_[i]);
+    }
+}
+
+const lv_style_t* StylePool::intern(const lv_style_t* style) {
+    if (!style) return nullptr;
+
+    std::array<StyleProperty, MAX_PROPS> props{};
+    const size_t count = styleProperties(style, props.data(), props.size());
+    if (count == 0 || count > props.size()) return style;
+
+    const uint32_t hash = hashProps(props.data(), count);
+    if (const lv_style_t* pooled = find(props.data(), count, hash)) return pooled;
+
+    Pooled* slot = freeSlot();
+    if (!slot) return style;
+    *slot = Pooled{style, hash, static_cast<uint8_t>(count), -1};
+    return style;
+}
+
+const lv_style_t* StylePool::intern(const StyleProperty* props, size_t count) {
+    if (!props || count == 0 || count > MAX_PROPS) return nullptr;
+
+    const uint32_t hash = hashProps(props, count);
+    if (const lv_style_t* pooled = find(props, count, hash)) return pooled;
+
+    Pooled* slot = freeSlot();
+    size_t owned = 0;
+    while (owned < ownedUsed_.size() && ownedUsed_[owned]) ++owned;
+    if (!slot || owned == ownedUsed_.size()) return nullptr;
+
+    lv_style_t& style = owned_[owned];
+    lv_style_init(&style);
+    for (size_t i = 0; i < count; ++i) lv_style_set_prop(&style, props[i].prop, props[i].value);
+    ownedUsed_[owned] = true;
+    *slot = Pooled{&style, hash, static_cast<uint8_t>(count), static_cast<int8_t>(owned)};
+    return &style;
+}
+
+void StylePool::attach(lv_obj_t* obj, const lv_style_t* style, lv_style_selector_t selector) {
+    if (!obj || !style) return;
+    lv_obj_add_style(obj, intern(style), selector);
+}
+
+StyleShareReport StylePool::shareLocalStyles(lv_obj_t* root) {
+    StyleShareReport report{};
+    if (!root) return report;
+
+    report.before = localStyleReport(root);
+    shareObject(root, report);
+    report.after = localStyleReport(root);
+    return report;
+}
+
+LocalStyleReport StylePool::localStyleReport(const lv_obj_t* root) {
+    LocalStyleReport report{};
+    if (root) addReport(root, report);
+    return report;
+}
+
+StylePoolStats StylePool::stats() const {
+    StylePoolStats stats{};
+    stats.lookups = lookups_;
+    stats.deduplicated = deduplicated_;
+    for (const auto& pooled : pooled_) {
+        if (!pooled.style) continue;
+        ++stats.styles;
+        if (pooled.owned < 0) continue;
+        ++stats.ownedStyles;
+        stats.ownedBytes += styleStorageBytes(pooled.style);
+    }
+    return stats;
+}
+
+const lv_style_t* StylePool::find(const StyleProperty* props, size_t count, uint32_t hash) {
+    ++lookups_;
+    std::array<StyleProperty, MAX_PROPS> candidate{};
+    for (const auto& pooled : pooled_) {
+        if (!pooled.style || pooled.hash != hash || pooled.propCount != count) continue;
+        const size_t n = styleProperties(pooled.style, candidate.data(), candidate.size());
+        if (!sameProps(props, count, candidate.data(), n)) continue;
+        ++deduplicated_;
+        return pooled.style;
+    }
+    return nullptr;
+}
+
+StylePool::Pooled* StylePool::freeSlot() {
+    for (auto& pooled : pooled_) {
+        if (!pooled.style) return &pooled;
+    }
+    return nullptr;
+}
+
+void StylePool::shareObject(lv_obj_t* obj, StyleShareReport& report) {
+    // Collect first: removing and adding styles reorders the style list.
+    std::array<ObjectStyleEntry, MAX_LOCAL_PER_OBJECT> locals{};
+    size_t localCount = 0;
+    const size_t styles = objectStyleCount(obj);
+    for (size_t i = 0; i < styles; ++i) {
+        ObjectStyleEntry entry{};
+        if (!objectStyleEntry(obj, i, &entry) || !entry.local) continue;
+        if (localCount == locals.size()) {
+            ++report.skipped;
+            continue;
+        }
+        locals[localCount++] = entry;
+    }
+
+    std::array<StyleProperty, MAX_PROPS> props{};
+    for (size_t i = 0; i < localCount; ++i) {
+        const ObjectStyleEntry& local = locals[i];
+        const size_t count = styleProperties(local.style, props.data(), props.size());
+        if (count == 0) {
+            // Emptied by lv_obj_remove_local_style_prop(): only the allocation is left.
+            lv_obj_remove_style(obj, local.style, local.selector);
+            ++report.replaced;
+            continue;
+        }
+        const lv_style_t* shared = intern(props.data(), count);
+        if (!shared) {
+            ++report.skipped;
+            continue;
+        }
+        // Removing a local style frees it; the pooled copy holds the properties.
+        lv_obj_remove_style(obj, local.style, local.selector);
+        lv_obj_add_style(obj, shared, local.selector);
+        ++report.replaced;
+    }
+
+    const uint32_t children = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < children; ++i) {
+        shareObject(lv_obj_get_child(obj, static_cast<int32_t>(i)), report);
+    }
+}
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include "ObjectIntrospection.hpp"
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief Local style cost of an object tree
+ *
+ * Each local style costs an lv_style_t, its property storage, and an entry in
+ * the object's style list. A shared style costs the object only the entry.
+ */
+struct LocalStyleReport {
+    uint32_t objects = 0;
+    uint32_t localStyles = 0;
+    size_t localBytes = 0;
+    uint32_t sharedEntries = 0;    ///< Non-local style list entries
+    size_t sharedEntryBytes = 0;
+
+    [[nodiscard]] size_t totalBytes() const { return localBytes + sharedEntryBytes; }
+};
+
+struct StyleShareReport {
+    LocalStyleReport before{};
+    LocalStyleReport after{};
+    uint32_t replaced = 0;   ///< Local styles swapped for pooled ones
+    uint32_t skipped = 0;    ///< Local styles kept (too many properties, or the pool is full)
+};
+
+struct StylePoolStats {
+    uint16_t styles = 0;         ///< Distinct styles in the pool
+    uint16_t ownedStyles = 0;    ///< Styles the pool built from local styles
+    size_t ownedBytes = 0;       ///< Heap held by owned styles
+    uint32_t lookups = 0;
+    uint32_t deduplicated = 0;   ///< Lookups answered by an identical pooled style
+};
+
+/**
+ * @brief Shared, deduplicated styles in place of per-object local styles
+ *
+ * LVGL keeps one heap-allocated local style per object and selector: the
+ * first lv_obj_set_style_*() call for a selector allocates it, later calls add
+ * to it. Objects styled alike therefore each carry a copy of the same
+ * properties. Pages that repeat the same look across many objects are cheaper
+ * with one shared style each. Define those styles as constants with
+ * LV_STYLE_CONST_INIT and attach() them, or let shareLocalStyles() convert
+ * the local styles of an existing tree into pooled, shared ones.
+ *
+ * Styles with equal property sets are pooled once. The pool must outlive
+ * every object using its styles.
+ *
+ * @code
+ * static const lv_style_const_prop_t VALUE_PROPS[] = {
+ *     LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xE0, 0xE0, 0xE0)),
+ *     LV_STYLE_CONST_TEXT_FONT(&fonts.mono),
+ *     LV_STYLE_CONST_PROPS_END,
+ * };
+ * static LV_STYLE_CONST_INIT(VALUE_STYLE, VALUE_PROPS);
+ *
+ * styles.attach(label, &VALUE_STYLE);
+ * auto report = styles.shareLocalStyles(view.getElement());
+ * // report.before.totalBytes() vs report.after.totalBytes()
+ * @endcode
+ */
+class StylePool {
+public:
+    static constexpr size_t MAX_STYLES = 32;
+    static constexpr size_t MAX_PROPS = 16;   ///< Properties of a poolable style
+
+    StylePool() = default;
+    ~StylePool();
+
+    StylePool(const StylePool&) = delete;
+    StylePool& operator=(const StylePool&) = delete;
+    StylePool(StylePool&&) = delete;
+    StylePool& operator=(StylePool&&) = delete;
+
+    /**
+     * @brief Pooled style equal to style, registering style if none is
+     *
+     * Registered styles are referenced, not copied: pass constants or styles
+     * that outlive the pool. Returns style itself when it cannot be pooled.
+     */
+    const lv_style_t* intern(const lv_style_t* style);
+
+    /** Pooled style with exactly these properties, built once; nullptr when the pool is full. */
+    const lv_style_t* intern(const StyleProperty* props, size_t count);
+
+    /** Adds the pooled equivalent of style to obj. */
+    void attach(lv_obj_t* obj, const lv_style_t* style, lv_style_selector_t selector = 0);
+
+    /**
+     * @brief Replaces the local styles of root and its descendants with pooled ones
+     *
+     * Cascade order is kept: a local style has the highest precedence of an
+     * object's normal styles, and a style added afterwards takes that place.
+     * Running transitions are left alone.
+     */
+    StyleShareReport shareLocalStyles(lv_obj_t* root);
+
+    /** Local style cost of root and its descendants. */
+    [[nodiscard]] static LocalStyleReport localStyleReport(const lv_obj_t* root);
+
+    [[nodiscard]] StylePoolStats stats() const;
+
+private:
+    struct Pooled {
+        const lv_style_t* style = nullptr;
+        uint32_t hash = 0;
+        uint8_t propCount = 0;
+        int8_t owned = -1;   ///< Index into owned_, or -1 for registered styles
+    };
+
+    const lv_style_t* find(const StyleProperty* props, size_t count, uint32_t hash);
+    Pooled* freeSlot();
+    void shareObject(lv_obj_t* obj, StyleShareReport& report);
+
+    std::array<Pooled, MAX_STYLES> pooled_{};
+    std::array<lv_style_t, MAX_STYLES> owned_{};
+    std::array<bool, MAX_STYLES> ownedUsed_{};
+    uint32_t lookups_ = 0;
+    uint32_t deduplicated_ = 0;
+};
+
+}  // namespace oc::ui::lvgl
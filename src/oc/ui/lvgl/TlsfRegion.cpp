@@ -0,0 +1,302 @@
+#include "TlsfRegion.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace oc::ui::lvgl {
+
+struct TlsfRegion::Block {
+    Block* prev_phys;   ///< Previous block in memory, nullptr for the first
+    size_t header;      ///< Payload size | tag << 1 | FREE
+    // Free blocks only, stored in the payload:
+    Block* next_free;
+    Block* prev_free;
+};
+
+namespace {
+
+constexpr size_t ALIGN = 8;
+constexpr size_t FREE = 1;
+constexpr size_t FLAGS = ALIGN - 1;
+constexpr size_t MAX_REGION = size_t{1} << 31;
+
+using Block = TlsfRegion::Block;
+
+constexpr size_t HEADER = offsetof(Block, next_free);
+constexpr size_t MIN_PAYLOAD = sizeof(Block) - HEADER;
+static_assert(HEADER % ALIGN == 0, "Block headers must keep payloads aligned");
+
+size_t alignUp(size_t value) {
+    return (value + ALIGN - 1) & ~(ALIGN - 1);
+}
+
+uint32_t highestBit(size_t value) {
+    return 31U - static_cast<uint32_t>(__builtin_clz(static_cast<uint32_t>(value)));
+}
+
+uint32_t lowestBit(uint32_t value) {
+    return static_cast<uint32_t>(__builtin_ctz(value));
+}
+
+size_t sizeOf(const Block* block) {
+    return block->header & ~FLAGS;
+}
+
+bool isFree(const Block* block) {
+    return (block->header & FREE) != 0;
+}
+
+uint8_t* payload(Block* block) {
+    return reinterpret_cast<uint8_t*>(block) + HEADER;
+}
+
+Block* fromPayload(const void* ptr) {
+    return reinterpret_cast<Block*>(const_cast<uint8_t*>(static_cast<const uint8_t*>(ptr)) - HEADER);
+}
+
+Block* nextPhys(Block* block) {
+    return reinterpret_cast<Block*>(payload(block) + sizeOf(block));
+}
+
+uint8_t tagOf(const Block* block) {
+    return static_cast<uint8_t>((block->header >> 1) & TlsfRegion::MAX_TAG);
+}
+
+}  // namespace
+
+bool TlsfRegion::init(void* region, size_t bytes) {
+    base_ = nullptr;
+    capacity_ = 0;
+    fl_bitmap_ = 0;
+    sl_bitmap_ = {};
+    free_ = {};
+    used_ = 0;
+    peak_ = 0;
+    live_blocks_ = 0;
+    failed_allocations_ = 0;
+    tag_bytes_ = {};
+
+    const auto address = reinterpret_cast<uintptr_t>(region);
+    const size_t skew = static_cast<size_t>(alignUp(address) - address);
+    if (!region || bytes <= skew + 2 * HEADER + MIN_PAYLOAD) return false;
+
+    base_ = static_cast<uint8_t*>(region) + skew;
+    capacity_ = std::min(bytes - skew, MAX_REGION) & ~(ALIGN - 1);
+
+    // One free block spanning the region, closed by a used zero-size sentinel.
+    auto* first = reinterpret_cast<Block*>(base_);
+    first->prev_phys = nullptr;
+    first->header = (capacity_ - 2 * HEADER) | FREE;
+    Block* sentinel = nextPhys(first);
+    sentinel->prev_phys = first;
+    sentinel->header = 0;
+    insertFree(first);
+    return true;
+}
+
+bool TlsfRegion::owns(const void* ptr) const {
+    const auto* p = static_cast<const uint8_t*>(ptr);
+    return base_ && p >= base_ + HEADER && p < base_ + capacity_;
+}
+
+void* TlsfRegion::allocate(size_t bytes, uint8_t tag) {
+    const size_t size = alignUp(std::max(bytes, MIN_PAYLOAD));
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+    Block* block = base_ && size >= bytes && size < capacity_ ? findFit(size, &fl, &sl) : nullptr;
+    if (!block) {
+        ++failed_allocations_;
+        return nullptr;
+    }
+
+    removeFree(block, fl, sl);
+    block->header &= ~FREE;
+    split(block, size);
+    markUsed(block, tag);
+    return payload(block);
+}
+
+void* TlsfRegion::reallocate(void* ptr, size_t bytes) {
+    if (!ptr) return allocate(bytes);
+    if (!owns(ptr)) return nullptr;
+
+    Block* block = fromPayload(ptr);
+    const size_t current = sizeOf(block);
+    const uint8_t tag = tagOf(block);
+    const size_t size = alignUp(std::max(bytes, MIN_PAYLOAD));
+    if (size < bytes) return nullptr;
+
+    Block* next = nextPhys(block);
+    const bool fits = size <= current;
+    const bool grows = !fits && isFree(next) && current + HEADER + sizeOf(next) >= size;
+    if (fits || grows) {
+        used_ -= current;
+        tag_bytes_[tag] -= current;
+        --live_blocks_;
+        if (grows) {
+            removeFree(next);
+            block->header = (current + HEADER + sizeOf(next)) | (block->header & FLAGS);
+            nextPhys(block)->prev_phys = block;
+        }
+        split(block, size);
+        markUsed(block, tag);
+        return ptr;
+    }
+
+    void* moved = allocate(bytes, tag);
+    if (!moved) return nullptr;
+    std::memcpy(moved, ptr, current);
+    release(ptr);
+    return moved;
+}
+
+void TlsfRegion::release(void* ptr) {
+    if (!owns(ptr)) return;
+
+    Block* block = fromPayload(ptr);
+    if (isFree(block)) return;
+
+    const size_t size = sizeOf(block);
+    used_ -= size;
+    tag_bytes_[tagOf(block)] -= size;
+    --live_blocks_;
+    block->header = size | FREE;
+    insertFree(merge(block));
+}
+
+size_t TlsfRegion::blockSize(const void* ptr) const {
+    return owns(ptr) ? sizeOf(fromPayload(ptr)) : 0;
+}
+
+uint8_t TlsfRegion::blockTag(const void* ptr) const {
+    return owns(ptr) ? tagOf(fromPayload(ptr)) : 0;
+}
+
+TlsfStats TlsfRegion::stats() const {
+    TlsfStats s{};
+    s.capacityBytes = capacity_;
+    s.usedBytes = used_;
+    s.peakBytes = peak_;
+    s.liveBlocks = live_blocks_;
+    s.failedAllocations = failed_allocations_;
+
+    for (const auto& row : free_) {
+        for (const Block* block : row) {
+            for (; block; block = block->next_free) {
+                const size_t size = sizeOf(block);
+                s.freeBytes += size;
+                s.largestFreeBytes = std::max(s.largestFreeBytes, size);
+                ++s.freeBlocks;
+            }
+        }
+    }
+    if (s.freeBytes > 0) {
+        s.fragmentationPct = static_cast<uint8_t>(((s.freeBytes - s.largestFreeBytes) * 100U) / s.freeBytes);
+    }
+    return s;
+}
+
+void TlsfRegion::mapping(size_t size, uint32_t* fl, uint32_t* sl) {
+    if (size < (size_t{1} << FL_SHIFT)) {
+        *fl = 0;
+        *sl = static_cast<uint32_t>(size >> ALIGN_LOG2);
+        return;
+    }
+    const uint32_t bit = highestBit(size);
+    *sl = static_cast<uint32_t>(size >> (bit - SL_LOG2)) ^ SL_COUNT;
+    *fl = bit - (FL_SHIFT - 1);
+}
+
+TlsfRegion::Block* TlsfRegion::findFit(size_t size, uint32_t* fl, uint32_t* sl) const {
+    // Round up to the next size class: every block listed there fits.
+    if (size >= (size_t{1} << FL_SHIFT)) size += (size_t{1} << (highestBit(size) - SL_LOG2)) - 1;
+    mapping(size, fl, sl);
+    if (*fl >= FL_COUNT) return nullptr;
+
+    uint32_t slMap = sl_bitmap_[*fl] & (~0U << *sl);
+    if (!slMap) {
+        const uint32_t flMap = *fl + 1 < 32 ? fl_bitmap_ & (~0U << (*fl + 1)) : 0;
+        if (!flMap) return nullptr;
+        *fl = lowestBit(flMap);
+        slMap = sl_bitmap_[*fl];
+    }
+    *sl = lowestBit(slMap);
+    return free_[*fl][*sl];
+}
+
+void TlsfRegion::insertFree(Block* block) {
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+    mapping(sizeOf(block), &fl, &sl);
+
+    Block* head = free_[fl][sl];
+    block->next_free = head;
+    block->prev_free = nullptr;
+    if (head) head->prev_free = block;
+    free_[fl][sl] = block;
+    sl_bitmap_[fl] |= 1U << sl;
+    fl_bitmap_ |= 1U << fl;
+}
+
+void TlsfRegion::removeFree(Block* block) {
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+    mapping(sizeOf(block), &fl, &sl);
+    removeFree(block, fl, sl);
+}
+
+void TlsfRegion::removeFree(Block* block, uint32_t fl, uint32_t sl) {
+    if (block->prev_free) {
+        block->prev_free->next_free = block->next_free;
+    } else {
+        free_[fl][sl] = block->next_free;
+    }
+    if (block->next_free) block->next_free->prev_free = block->prev_free;
+
+    if (!free_[fl][sl]) {
+        sl_bitmap_[fl] &= ~(1U << sl);
+        if (!sl_bitmap_[fl]) fl_bitmap_ &= ~(1U << fl);
+    }
+}
+
+TlsfRegion::Block* TlsfRegion::merge(Block* block) {
+    Block* prev = block->prev_phys;
+    if (prev && isFree(prev)) {
+        removeFree(prev);
+        prev->header = (sizeOf(prev) + HEADER + sizeOf(block)) | FREE;
+        block = prev;
+        nextPhys(block)->prev_phys = block;
+    }
+
+    Block* next = nextPhys(block);
+    if (isFree(next)) {
+        removeFree(next);
+        block->header = (sizeOf(block) + HEADER + sizeOf(next)) | FREE;
+        nextPhys(block)->prev_phys = block;
+    }
+    return block;
+}
+
+void TlsfRegion::split(Block* block, size_t size) {
+    const size_t current = sizeOf(block);
+    if (current < size + HEADER + MIN_PAYLOAD) return;
+
+    auto* rest = reinterpret_cast<Block*>(payload(block) + size);
+    rest->prev_phys = block;
+    rest->header = (current - size - HEADER) | FREE;
+    block->header = size | (block->header & FLAGS);
+    nextPhys(rest)->prev_phys = rest;
+    insertFree(merge(rest));
+}
+
+void TlsfRegion::markUsed(Block* block, uint8_t tag) {
+    if (tag > MAX_TAG) tag = 0;
+    const size_t size = sizeOf(block);
+    block->header = size | (static_cast<size_t>(tag) << 1);
+    used_ += size;
+    peak_ = std::max(peak_, used_);
+    tag_bytes_[tag] += size;
+    ++live_blocks_;
+}
+
+}  // namespace oc::ui::lvgl
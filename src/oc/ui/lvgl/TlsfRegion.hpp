@@ -0,0 +1,103 @@
+#pragma once
+
+/**
+ * @file TlsfRegion.hpp
+ * @brief Two-level segregated fit allocator over a caller-owned region
+ *
+ * Free blocks are binned by size class: a first level per power of two,
+ * split into SL_COUNT linear sub-classes. Two bitmaps locate a fitting bin in
+ * constant time, and freed blocks merge with free physical neighbours at
+ * once, so allocation and release cost O(1) whatever the heap state. Used by
+ * the package LVGL heap (see Heap.hpp) for each memory region.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief Occupancy of one region
+ */
+struct TlsfStats {
+    size_t capacityBytes = 0;      ///< Bytes available to blocks, headers included
+    size_t usedBytes = 0;          ///< Payload bytes of live blocks
+    size_t peakBytes = 0;
+    size_t freeBytes = 0;          ///< Payload bytes of free blocks
+    size_t largestFreeBytes = 0;   ///< Largest allocation that can currently succeed
+    uint32_t liveBlocks = 0;
+    uint32_t freeBlocks = 0;
+    uint32_t failedAllocations = 0;
+    uint8_t fragmentationPct = 0;  ///< Free bytes outside the largest free block
+};
+
+/**
+ * Region allocator. Not thread-safe: use from the LVGL thread only.
+ *
+ * Each block carries a tag (0..MAX_TAG) so usage can be attributed per
+ * caller; tagBytes() reports live payload per tag.
+ */
+class TlsfRegion {
+public:
+    static constexpr uint8_t MAX_TAG = 3;
+
+    /// Block header preceding every payload.
+    struct Block;
+
+    TlsfRegion() = default;
+    TlsfRegion(void* region, size_t bytes) { init(region, bytes); }
+
+    TlsfRegion(const TlsfRegion&) = delete;
+    TlsfRegion& operator=(const TlsfRegion&) = delete;
+    TlsfRegion(TlsfRegion&&) = delete;
+    TlsfRegion& operator=(TlsfRegion&&) = delete;
+
+    /** Takes over region; anything allocated from a previous region is forgotten. */
+    bool init(void* region, size_t bytes);
+
+    [[nodiscard]] bool valid() const { return base_ != nullptr; }
+    [[nodiscard]] bool owns(const void* ptr) const;
+
+    void* allocate(size_t bytes, uint8_t tag = 0);
+    /** Grows or shrinks in place when possible; nullptr leaves ptr untouched. */
+    void* reallocate(void* ptr, size_t bytes);
+    void release(void* ptr);
+
+    /** Payload bytes of the block holding ptr. */
+    [[nodiscard]] size_t blockSize(const void* ptr) const;
+    /** Tag the block holding ptr was allocated with. */
+    [[nodiscard]] uint8_t blockTag(const void* ptr) const;
+
+    [[nodiscard]] TlsfStats stats() const;
+    [[nodiscard]] size_t tagBytes(uint8_t tag) const { return tag <= MAX_TAG ? tag_bytes_[tag] : 0; }
+
+private:
+    static constexpr uint32_t SL_LOG2 = 3;
+    static constexpr uint32_t SL_COUNT = 1U << SL_LOG2;
+    static constexpr uint32_t ALIGN_LOG2 = 3;
+    static constexpr uint32_t FL_SHIFT = SL_LOG2 + ALIGN_LOG2;
+    static constexpr uint32_t FL_COUNT = 32 - FL_SHIFT + 1;
+
+    static void mapping(size_t size, uint32_t* fl, uint32_t* sl);
+    Block* findFit(size_t size, uint32_t* fl, uint32_t* sl) const;
+    void insertFree(Block* block);
+    void removeFree(Block* block);
+    void removeFree(Block* block, uint32_t fl, uint32_t sl);
+    Block* merge(Block* block);
+    void split(Block* block, size_t size);
+    void markUsed(Block* block, uint8_t tag);
+
+    uint8_t* base_ = nullptr;
+    size_t capacity_ = 0;
+    uint32_t fl_bitmap_ = 0;
+    std::array<uint32_t, FL_COUNT> sl_bitmap_{};
+    std::array<std::array<Block*, SL_COUNT>, FL_COUNT> free_{};
+    size_t used_ = 0;
+    size_t peak_ = 0;
+    uint32_t live_blocks_ = 0;
+    uint32_t failed_allocations_ = 0;
+    std::array<size_t, MAX_TAG + 1> tag_bytes_{};
+};
+
+}  // namespace oc::ui::lvgl
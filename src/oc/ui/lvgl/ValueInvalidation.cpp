@@ -0,0 +1,272 @@
+#include "ValueInvalidation.hpp"
+
+#include <algorithm>
+
+#include <oc/Config.hpp>
+
+#include "StaticSurfaceInvalidation.hpp"
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+constexpr int32_t MAX_SECTOR_DEGREES = 30;  ///< Sweep per rectangle; keeps boxes close to the ring
+constexpr int32_t AA_MARGIN = 1;
+
+#if OC_ENABLE_STATS
+ValueInvalidationStats g_stats{};
+#endif
+
+int32_t normalizeAngle(int32_t angle) {
+    angle %= 360;
+    return angle < 0 ? angle + 360 : angle;
+}
+
+struct ArcGeometry {
+    lv_point_t center{};
+    int32_t radius = 0;       ///< Background radius, where the knob sits
+    int32_t indicRadius = 0;  ///< Outer edge of the indicator
+    int32_t width = 0;        ///< Indicator width
+    bool rounded = false;
+    int32_t rotation = 0;
+};
+
+int32_t maxPad(const lv_obj_t* obj, lv_part_t part) {
+    return std::max({lv_obj_get_style_pad_left(obj, part), lv_obj_get_style_pad_right(obj, part),
+                     lv_obj_get_style_pad_top(obj, part), lv_obj_get_style_pad_bottom(obj, part)});
+}
+
+// Mirrors lv_arc's get_center(): the circle fits the padded background.
+ArcGeometry arcGeometry(lv_obj_t* arc) {
+    ArcGeometry g{};
+    lv_area_t coords{};
+    lv_obj_get_coords(arc, &coords);
+    const int32_t left = lv_obj_get_style_pad_left(arc, LV_PART_MAIN);
+    const int32_t right = lv_obj_get_style_pad_right(arc, LV_PART_MAIN);
+    const int32_t top = lv_obj_get_style_pad_top(arc, LV_PART_MAIN);
+    const int32_t bottom = lv_obj_get_style_pad_bottom(arc, LV_PART_MAIN);
+    g.radius = std::min(lv_obj_get_width(arc) - left - right, lv_obj_get_height(arc) - top - bottom) / 2;
+    g.center = {coords.x1 + left + g.radius, coords.y1 + top + g.radius};
+    g.indicRadius = g.radius - maxPad(arc, LV_PART_INDICATOR);
+    g.width = lv_obj_get_style_arc_width(arc, LV_PART_INDICATOR);
+    g.rounded = lv_obj_get_style_arc_rounded(arc, LV_PART_INDICATOR);
+    g.rotation = lv_arc_get_rotation(arc);
+    return g;
+}
+
+lv_point_t polar(const lv_point_t& center, int32_t radius, int32_t angle) {
+    const auto a = static_cast<int16_t>(normalizeAngle(angle));
+    return {center.x + ((radius * lv_trigo_cos(a)) >> LV_TRIGO_SHIFT),
+            center.y + ((radius * lv_trigo_sin(a)) >> LV_TRIGO_SHIFT)};
+}
+
+void extend(lv_area_t& area, const lv_point_t& p) {
+    area.x1 = std::min(area.x1, p.x);
+    area.y1 = std::min(area.y1, p.y);
+    area.x2 = std::max(area.x2, p.x);
+    area.y2 = std::max(area.y2, p.y);
+}
+
+/// Bounds of the ring sector from a0 clockwise to a1, both within one quadrant.
+lv_area_t sectorArea(const ArcGeometry& g, int32_t a0, int32_t a1) {
+    const int32_t inner = std::max<int32_t>(0, g.indicRadius - g.width);
+    const lv_point_t first = polar(g.center, g.indicRadius, a0);
+    lv_area_t area{first.x, first.y, first.x, first.y};
+    extend(area, polar(g.center, inner, a0));
+    extend(area, polar(g.center, g.indicRadius, a1));
+    extend(area, polar(g.center, inner, a1));
+
+    const int32_t margin = (g.rounded ? g.width / 2 : 0) + AA_MARGIN;
+    return {area.x1 - margin, area.y1 - margin, area.x2 + margin, area.y2 + margin};
+}
+
+/// Adds the sweep between two absolute angles, measured along the arc from start.
+void addSweep(const ArcGeometry& g, int32_t arcStart, int32_t from, int32_t to, ValueDeltaAreas& out) {
+    if (from == to) return;
+    int32_t o0 = normalizeAngle(from - arcStart);
+    int32_t o1 = normalizeAngle(to - arcStart);
+    if (o0 > o1) std::swap(o0, o1);
+
+    int32_t a = arcStart + o0;
+    const int32_t end = arcStart + o1;
+    while (a < end) {
+        // Split at quadrant boundaries and at MAX_SECTOR_DEGREES.
+        const int32_t quadrantEnd = a + (90 - normalizeAngle(a) % 90);
+        const int32_t next = std::min({end, a + MAX_SECTOR_DEGREES, quadrantEnd});
+        out.add(sectorArea(g, a, next));
+        a = next;
+    }
+}
+
+// Mirrors lv_arc's get_knob_area() for a knob at the given absolute angle.
+lv_area_t knobArea(lv_obj_t* arc, const ArcGeometry& g, int32_t angle) {
+    const int32_t half = g.width / 2;
+    const lv_point_t p = polar(g.center, g.radius - half, angle);
+    return {p.x - lv_obj_get_style_pad_left(arc, LV_PART_KNOB) - half - AA_MARGIN,
+            p.y - lv_obj_get_style_pad_top(arc, LV_PART_KNOB) - half - AA_MARGIN,
+            p.x + lv_obj_get_style_pad_right(arc, LV_PART_KNOB) + half + AA_MARGIN,
+            p.y + lv_obj_get_style_pad_bottom(arc, LV_PART_KNOB) + half + AA_MARGIN};
+}
+
+int32_t arcKnobAngle(lv_obj_t* arc, int32_t start, int32_t end) {
+    switch (lv_arc_get_mode(arc)) {
+        case LV_ARC_MODE_REVERSE:
+            return start;
+        case LV_ARC_MODE_SYMMETRICAL: {
+            const int32_t mid = (lv_arc_get_min_value(arc) + lv_arc_get_max_value(arc)) / 2;
+            return lv_arc_get_value(arc) < mid ? start : end;
+        }
+        default:
+            return end;
+    }
+}
+
+bool barIsVertical(lv_obj_t* bar) {
+    const auto orientation = lv_bar_get_orientation(bar);
+    return orientation == LV_BAR_ORIENTATION_VERTICAL
+        || (orientation == LV_BAR_ORIENTATION_AUTO && lv_obj_get_height(bar) > lv_obj_get_width(bar));
+}
+
+#if OC_ENABLE_STATS
+void record(lv_obj_t* obj, const ValueDeltaAreas& areas) {
+    lv_area_t coords{};
+    lv_obj_get_coords(obj, &coords);
+    ++g_stats.updates;
+    g_stats.boxPixels += detail::areaPixels(coords);
+    for (const lv_area_t& area : areas) g_stats.deltaPixels += detail::areaPixels(area);
+}
+#endif
+
+template <typename Capture, typename Delta, typename Set>
+void setMinimal(lv_obj_t* obj, Capture capture, Delta delta, Set set) {
+    ValueDeltaAreas areas;
+    {
+        StaticSurfaceInvalidationBatch<ValueDeltaAreas::capacity()> batch(obj);
+        const auto before = capture(obj);
+        set();
+        const auto after = capture(obj);
+        delta(obj, before, after, areas);
+        for (const lv_area_t& area : areas) batch.include(area);
+    }
+#if OC_ENABLE_STATS
+    record(obj, areas);
+#endif
+}
+
+}  // namespace
+
+ArcValueState captureArcState(lv_obj_t* arc) {
+    ArcValueState state{};
+    if (!arc) return state;
+
+    const ArcGeometry g = arcGeometry(arc);
+    state.startAngle = static_cast<int32_t>(lv_arc_get_angle_start(arc)) + g.rotation;
+    state.endAngle = static_cast<int32_t>(lv_arc_get_angle_end(arc)) + g.rotation;
+    const int32_t knobAngle = arcKnobAngle(arc, state.startAngle, state.endAngle) + lv_arc_get_knob_offset(arc);
+    state.knob = knobArea(arc, g, knobAngle);
+    return state;
+}
+
+void arcDeltaAreas(lv_obj_t* arc, const ArcValueState& before, const ArcValueState& after,
+                   ValueDeltaAreas& out) {
+    if (!arc) return;
+
+    const ArcGeometry g = arcGeometry(arc);
+    const int32_t arcStart = static_cast<int32_t>(lv_arc_get_bg_angle_start(arc)) + g.rotation;
+    addSweep(g, arcStart, before.startAngle, after.startAngle, out);
+    addSweep(g, arcStart, before.endAngle, after.endAngle, out);
+    if (!detail::areaContains(before.knob, after.knob) || !detail::areaContains(after.knob, before.knob)) {
+        out.add(before.knob);
+        out.add(after.knob);
+    }
+}
+
+BarValueState captureBarState(lv_obj_t* bar) {
+    BarValueState state{};
+    if (!bar) return state;
+
+    lv_area_t coords{};
+    lv_obj_get_coords(bar, &coords);
+    const bool vertical = barIsVertical(bar);
+    const bool rtl = !vertical && lv_obj_get_style_base_dir(bar, LV_PART_MAIN) == LV_BASE_DIR_RTL;
+
+    // Indicator travel: the background minus its padding, as lv_bar draws it.
+    const int32_t first = vertical ? coords.y2 - lv_obj_get_style_pad_bottom(bar, LV_PART_MAIN)
+                                   : coords.x1 + lv_obj_get_style_pad_left(bar, LV_PART_MAIN);
+    const int32_t last = vertical ? coords.y1 + lv_obj_get_style_pad_top(bar, LV_PART_MAIN)
+                                  : coords.x2 - lv_obj_get_style_pad_right(bar, LV_PART_MAIN);
+    const int32_t min = lv_bar_get_min_value(bar);
+    const int32_t max = lv_bar_get_max_value(bar);
+    auto position = [&](int32_t value) {
+        const int32_t p = max == min ? first : lv_map(value, min, max, first, last);
+        return rtl ? first + last - p : p;
+    };
+
+    int32_t startValue = min;
+    if (lv_bar_get_mode(bar) == LV_BAR_MODE_RANGE) {
+        startValue = lv_bar_get_start_value(bar);
+    } else if (lv_bar_get_mode(bar) == LV_BAR_MODE_SYMMETRICAL) {
+        startValue = std::clamp<int32_t>(0, std::min(min, max), std::max(min, max));
+    }
+    state.start = position(startValue);
+    state.end = position(lv_bar_get_value(bar));
+
+    if (lv_obj_check_type(bar, &lv_slider_class)) {
+        // Knob centred on the indicator end, as tall as the bar plus knob padding.
+        const int32_t half = (vertical ? lv_obj_get_width(bar) : lv_obj_get_height(bar)) / 2;
+        const int32_t cross = vertical ? (coords.x1 + coords.x2) / 2 : (coords.y1 + coords.y2) / 2;
+        const lv_point_t c = vertical ? lv_point_t{cross, state.end} : lv_point_t{state.end, cross};
+        state.knob = {c.x - half - lv_obj_get_style_pad_left(bar, LV_PART_KNOB) - AA_MARGIN,
+                      c.y - half - lv_obj_get_style_pad_top(bar, LV_PART_KNOB) - AA_MARGIN,
+                      c.x + half + lv_obj_get_style_pad_right(bar, LV_PART_KNOB) + AA_MARGIN,
+                      c.y + half + lv_obj_get_style_pad_bottom(bar, LV_PART_KNOB) + AA_MARGIN};
+        state.hasKnob = true;
+    }
+    return state;
+}
+
+void barDeltaAreas(lv_obj_t* bar, const BarValueState& before, const BarValueState& after,
+                   ValueDeltaAreas& out) {
+    if (!bar) return;
+
+    lv_area_t coords{};
+    lv_obj_get_coords(bar, &coords);
+    const bool vertical = barIsVertical(bar);
+    // The rounded end of the indicator reshapes up to its radius around the edge.
+    const int32_t reach = std::min<int32_t>(lv_obj_get_style_radius(bar, LV_PART_INDICATOR),
+                                            (vertical ? lv_obj_get_width(bar) : lv_obj_get_height(bar)) / 2)
+        + AA_MARGIN;
+
+    auto strip = [&](int32_t from, int32_t to) {
+        if (from == to) return;
+        const int32_t lo = std::min(from, to) - reach;
+        const int32_t hi = std::max(from, to) + reach;
+        out.add(vertical ? lv_area_t{coords.x1, lo, coords.x2, hi} : lv_area_t{lo, coords.y1, hi, coords.y2});
+    };
+    strip(before.start, after.start);
+    strip(before.end, after.end);
+    if (before.hasKnob && before.end != after.end) {
+        out.add(before.knob);
+        out.add(after.knob);
+    }
+}
+
+void setArcValueMinimal(lv_obj_t* arc, int32_t value) {
+    if (!arc || lv_arc_get_value(arc) == value) return;
+    setMinimal(arc, captureArcState, arcDeltaAreas, [&] { lv_arc_set_value(arc, value); });
+}
+
+void setBarValueMinimal(lv_obj_t* bar, int32_t value) {
+    if (!bar || lv_bar_get_value(bar) == value) return;
+    setMinimal(bar, captureBarState, barDeltaAreas, [&] { lv_bar_set_value(bar, value, LV_ANIM_OFF); });
+}
+
+ValueInvalidationStats valueInvalidationStats() {
+#if OC_ENABLE_STATS
+    return g_stats;
+#else
+    return {};
+#endif
+}
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+#include "InvalidationRegions.hpp"
+
+namespace oc::ui::lvgl {
+
+/**
+ * Minimal invalidation for value changes of arcs, bars and sliders.
+ *
+ * A state is captured before and after the value changes; the helpers then
+ * compute the small rectangles covering only what moved: the angular delta of
+ * an arc indicator (split into narrow ring sectors), the linear delta of a
+ * bar indicator, and the old and new knob. setArcValueMinimal() and
+ * setBarValueMinimal() wrap this in a StaticSurfaceInvalidationBatch, so the
+ * widget's own invalidation is replaced by those rectangles.
+ *
+ * The static-surface contract applies: no shadow, outline or transform on
+ * the widget parts, and no animation (values are set with LV_ANIM_OFF).
+ */
+
+/// Rectangles covering one value change.
+using ValueDeltaAreas = InvalidationRegionSet<8>;
+
+/** Drawn geometry of an arc value (absolute angles, knob bounds). */
+struct ArcValueState {
+    int32_t startAngle = 0;
+    int32_t endAngle = 0;
+    lv_area_t knob{};
+};
+
+/** Drawn geometry of a bar or slider value (indicator edges in pixels). */
+struct BarValueState {
+    int32_t start = 0;
+    int32_t end = 0;
+    lv_area_t knob{};  ///< Sliders only
+    bool hasKnob = false;
+};
+
+/** Pixels invalidated by the helpers (zero without OC_ENABLE_STATS). */
+struct ValueInvalidationStats {
+    uint32_t updates = 0;
+    uint64_t deltaPixels = 0;  ///< Pixels invalidated by the helpers
+    uint64_t boxPixels = 0;    ///< Pixels of the widgets' full bounds, for comparison
+};
+
+[[nodiscard]] ArcValueState captureArcState(lv_obj_t* arc);
+void arcDeltaAreas(lv_obj_t* arc, const ArcValueState& before, const ArcValueState& after,
+                   ValueDeltaAreas& out);
+
+[[nodiscard]] BarValueState captureBarState(lv_obj_t* bar);
+void barDeltaAreas(lv_obj_t* bar, const BarValueState& before, const BarValueState& after,
+                   ValueDeltaAreas& out);
+
+/** lv_arc_set_value() invalidating only the changed sector and knob. */
+void setArcValueMinimal(lv_obj_t* arc, int32_t value);
+
+/** lv_bar_set_value() / lv_slider_set_value() invalidating only the changed strip and knob. */
+void setBarValueMinimal(lv_obj_t* bar, int32_t value);
+
+[[nodiscard]] ValueInvalidationStats valueInvalidationStats();
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,216 @@
+#include "ViewManager.hpp"
+
+#include <utility>
+
+#include "MonotonicClock.hpp"
+
+namespace oc::ui::lvgl {
+
+ViewManager::ViewManager(RetainedSurfaceParkingLot& lot, lv_obj_t* container, const ViewManagerConfig& config)
+    : lot_(lot), container_(container), config_(config) {}
+
+ViewManager::~ViewManager() {
+    if (IView* active = view(current_)) active->onDeactivate();
+    current_ = INVALID_VIEW;
+    for (auto& e : entries_) e.view.reset();
+}
+
+ViewManager::ViewId ViewManager::add(ViewFactory factory, const ViewPolicy& policy) {
+    if (!factory) return INVALID_VIEW;
+
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        Entry& e = entries_[i];
+        if (e.used) continue;
+        e = Entry{};
+        e.factory = std::move(factory);
+        e.policy = policy;
+        e.used = true;
+        return static_cast<ViewId>(i);
+    }
+    return INVALID_VIEW;
+}
+
+void ViewManager::remove(ViewId id) {
+    Entry* e = entry(id);
+    if (!e) return;
+
+    if (id == current_) {
+        if (e->view) e->view->onDeactivate();
+        current_ = INVALID_VIEW;
+    }
+    if (e->view) ++stats_.destroyed;
+    *e = Entry{};
+}
+
+bool ViewManager::show(ViewId id) {
+    Entry* target = entry(id);
+    if (!target) return false;
+    if (id == current_) return true;
+
+    const uint32_t start = monotonicMicros();
+    const ViewTier from = target->tier;
+
+    // Bring the target up first: if its factory fails, the current view stays.
+    setTier(*target, ViewTier::Hot);
+    if (target->tier != ViewTier::Hot) return false;
+
+    if (Entry* previous = entry(current_)) leave(*previous);
+    current_ = id;
+    if (target->activations < UINT16_MAX) ++target->activations;
+    target->lastShown = ++clock_;
+    target->view->onActivate();
+    enforceLimits();
+
+    const uint32_t elapsed = monotonicMicros() - start;
+    ++stats_.switches;
+    switch (from) {
+        case ViewTier::Hot: ++stats_.hotSwitches; break;
+        case ViewTier::Warm: ++stats_.warmSwitches; break;
+        case ViewTier::Cold:
+            ++stats_.coldSwitches;
+            if (elapsed > stats_.maxColdSwitchUs) stats_.maxColdSwitchUs = elapsed;
+            break;
+    }
+    stats_.lastSwitchUs = elapsed;
+    stats_.totalSwitchUs += elapsed;
+    if (elapsed > stats_.maxSwitchUs) stats_.maxSwitchUs = elapsed;
+    return true;
+}
+
+bool ViewManager::prepare(ViewId id) {
+    Entry* e = entry(id);
+    if (!e) return false;
+    if (e->tier != ViewTier::Cold) return true;
+
+    setTier(*e, ViewTier::Warm);
+    if (e->tier == ViewTier::Cold) return false;
+    // A fresh view starts active; prepared views wait deactivated like parked ones.
+    e->view->onDeactivate();
+    e->lastShown = ++clock_;
+    enforceLimits();
+    return e->tier != ViewTier::Cold;
+}
+
+void ViewManager::demote(ViewId id, ViewTier tier) {
+    Entry* e = entry(id);
+    if (!e || id == current_ || tier >= e->tier) return;
+    setTier(*e, tier);
+}
+
+void ViewManager::setPolicy(ViewId id, const ViewPolicy& policy) {
+    if (Entry* e = entry(id)) e->policy = policy;
+}
+
+void ViewManager::configure(const ViewManagerConfig& config) {
+    config_ = config;
+    enforceLimits();
+}
+
+IView* ViewManager::view(ViewId id) const {
+    const Entry* e = entry(id);
+    return e ? e->view.get() : nullptr;
+}
+
+ViewTier ViewManager::tier(ViewId id) const {
+    const Entry* e = entry(id);
+    return e ? e->tier : ViewTier::Cold;
+}
+
+ViewManagerStats ViewManager::stats() const {
+    ViewManagerStats stats = stats_;
+    stats.hot = static_cast<uint8_t>(count(ViewTier::Hot));
+    stats.warm = static_cast<uint8_t>(count(ViewTier::Warm));
+    return stats;
+}
+
+ViewManager::Entry* ViewManager::entry(ViewId id) {
+    if (id >= entries_.size() || !entries_[id].used) return nullptr;
+    return &entries_[id];
+}
+
+const ViewManager::Entry* ViewManager::entry(ViewId id) const {
+    if (id >= entries_.size() || !entries_[id].used) return nullptr;
+    return &entries_[id];
+}
+
+void ViewManager::leave(Entry& e) {
+    if (e.view) e.view->onDeactivate();
+
+    const ViewTier keep = e.activations < e.policy.promoteAfter ? ViewTier::Cold : e.policy.retain;
+    if (keep < e.tier) setTier(e, keep);
+}
+
+void ViewManager::setTier(Entry& e, ViewTier tier) {
+    if (tier == e.tier) return;
+
+    if (tier == ViewTier::Cold) {
+        e.view.reset();
+        e.tier = ViewTier::Cold;
+        ++stats_.destroyed;
+        return;
+    }
+
+    if (tier == ViewTier::Hot) {
+        if (e.view) {
+            RetainedSurfaceParkingLot::attach(e.view->getElement(), container_);
+        } else {
+            e.view = e.factory(container_);
+            if (!e.view) return;
+        }
+        e.tier = ViewTier::Hot;
+        return;
+    }
+
+    // Warm: parked in the keyed host mirroring the container.
+    if (e.view) {
+        if (!lot_.parkKeyed(e.view->getElement())) return;  // No host: stays Hot
+    } else {
+        lv_obj_t* host = lot_.hostFor(container_);
+        if (!host) return;
+        e.view = e.factory(host);
+        if (!e.view) return;
+    }
+    e.tier = ViewTier::Warm;
+}
+
+size_t ViewManager::count(ViewTier tier) const {
+    size_t n = 0;
+    for (const auto& e : entries_) {
+        if (e.used && e.tier == tier) ++n;
+    }
+    return n;
+}
+
+ViewManager::Entry* ViewManager::leastRecent(ViewTier tier) {
+    Entry* oldest = nullptr;
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        Entry& e = entries_[i];
+        if (!e.used || e.tier != tier || i == current_) continue;
+        if (!oldest || e.lastShown < oldest->lastShown) oldest = &e;
+    }
+    return oldest;
+}
+
+void ViewManager::enforceLimits() {
+    while (count(ViewTier::Hot) > config_.maxHot) {
+        Entry* e = leastRecent(ViewTier::Hot);
+        if (!e) break;
+        setTier(*e, ViewTier::Warm);
+        if (e->tier == ViewTier::Hot) setTier(*e, ViewTier::Cold);
+        ++stats_.demotions;
+    }
+
+    auto overWarm = [this]() {
+        const size_t warm = count(ViewTier::Warm);
+        if (warm > config_.maxWarm) return true;
+        return config_.demoteUnderPressure && warm > 0 && lot_.underPressure();
+    };
+    while (overWarm()) {
+        Entry* e = leastRecent(ViewTier::Warm);
+        if (!e) break;
+        setTier(*e, ViewTier::Cold);
+        ++stats_.demotions;
+    }
+}
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include <lvgl.h>
+
+#include "IView.hpp"
+#include "RetainedSurfaceParkingLot.hpp"
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief Residency of a view
+ *
+ * Hot views are attached to the container (inactive ones hidden by their own
+ * onDeactivate), Warm views are parked off-screen, Cold views do not exist.
+ */
+enum class ViewTier : uint8_t { Cold, Warm, Hot };
+
+/**
+ * @brief Per-view demotion policy, applied when the view is left
+ */
+struct ViewPolicy {
+    ViewTier retain = ViewTier::Warm;   ///< Highest tier kept while inactive
+    uint8_t promoteAfter = 0;           ///< Activations before the view is retained above Cold
+};
+
+/**
+ * @brief Tier capacities; the least recently shown views are demoted first
+ */
+struct ViewManagerConfig {
+    uint8_t maxHot = 1;                 ///< Attached views, including the active one
+    uint8_t maxWarm = 3;                ///< Parked views
+    bool demoteUnderPressure = true;    ///< Destroy warm views while the parking lot is under pressure
+};
+
+struct ViewManagerStats {
+    uint8_t hot = 0;
+    uint8_t warm = 0;
+    uint32_t switches = 0;
+    uint32_t hotSwitches = 0;    ///< Target was attached already
+    uint32_t warmSwitches = 0;   ///< Target was reparented from the parking lot
+    uint32_t coldSwitches = 0;   ///< Target was built
+    uint32_t demotions = 0;      ///< Views moved down a tier by capacity or pressure
+    uint32_t destroyed = 0;
+    uint32_t lastSwitchUs = 0;
+    uint32_t maxSwitchUs = 0;
+    uint32_t maxColdSwitchUs = 0;
+    uint64_t totalSwitchUs = 0;
+};
+
+/**
+ * @brief Owns IViews and switches between them across three residency tiers
+ *
+ * Frequent views stay Hot or Warm, so switching to them is a reparent at
+ * most; rare views go Cold when left and cost no memory until shown again.
+ * A view's factory builds it under the container and its destructor must
+ * delete its LVGL tree.
+ *
+ * When the active view is left it receives onDeactivate() (which pauses its
+ * timers and animations) and is kept at its policy's retain tier: attached,
+ * parked in the lot's keyed host for the container, or destroyed. Views
+ * shown fewer than promoteAfter times go Cold. Over capacity, the least
+ * recently shown views are demoted one tier at a time.
+ *
+ * Destroy the manager before the parking lot.
+ *
+ * @code
+ * ViewManager views(lot, lv_screen_active(), {.maxHot = 2, .maxWarm = 3});
+ * auto main = views.add([](lv_obj_t* p) { return std::make_unique<MainView>(p); },
+ *                       {.retain = ViewTier::Hot});
+ * auto setup = views.add([](lv_obj_t* p) { return std::make_unique<SetupView>(p); },
+ *                        {.retain = ViewTier::Cold});
+ * views.show(main);
+ * @endcode
+ */
+class ViewManager {
+public:
+    using ViewId = uint8_t;
+    using ViewFactory = std::function<std::unique_ptr<IView>(lv_obj_t* parent)>;
+
+    static constexpr ViewId INVALID_VIEW = 0xFF;
+    static constexpr size_t MAX_VIEWS = 16;
+
+    ViewManager(RetainedSurfaceParkingLot& lot, lv_obj_t* container, const ViewManagerConfig& config = {});
+    ~ViewManager();
+
+    ViewManager(const ViewManager&) = delete;
+    ViewManager& operator=(const ViewManager&) = delete;
+    ViewManager(ViewManager&&) = delete;
+    ViewManager& operator=(ViewManager&&) = delete;
+
+    /** Registers a view, Cold until shown or prepared. */
+    [[nodiscard]] ViewId add(ViewFactory factory, const ViewPolicy& policy = {});
+
+    /** Destroys the view if it exists and forgets it; the active view is deactivated first. */
+    void remove(ViewId id);
+
+    /**
+     * Activates id, building it if Cold, then deactivates the previous view.
+     * @return false if id could not be built; the current view is kept
+     */
+    bool show(ViewId id);
+
+    /** Builds an inactive view and parks it Warm ahead of use. */
+    bool prepare(ViewId id);
+
+    /** Demotes an inactive view to tier (never promotes). */
+    void demote(ViewId id, ViewTier tier);
+
+    void setPolicy(ViewId id, const ViewPolicy& policy);
+    void configure(const ViewManagerConfig& config);
+
+    [[nodiscard]] ViewId current() const { return current_; }
+    [[nodiscard]] IView* view(ViewId id) const;
+    [[nodiscard]] ViewTier tier(ViewId id) const;
+    [[nodiscard]] ViewManagerStats stats() const;
+
+private:
+    struct Entry {
+        ViewFactory factory;
+        ViewPolicy policy{};
+        std::unique_ptr<IView> view;
+        ViewTier tier = ViewTier::Cold;
+        uint32_t lastShown = 0;
+        uint16_t activations = 0;
+        bool used = false;
+    };
+
+    Entry* entry(ViewId id);
+    const Entry* entry(ViewId id) const;
+    void leave(Entry& entry);
+    void setTier(Entry& entry, ViewTier tier);
+    size_t count(ViewTier tier) const;
+    Entry* leastRecent(ViewTier tier);
+    void enforceLimits();
+
+    RetainedSurfaceParkingLot& lot_;
+    lv_obj_t* container_ = nullptr;
+    ViewManagerConfig config_{};
+    std::array<Entry, MAX_VIEWS> entries_{};
+    ViewId current_ = INVALID_VIEW;
+    uint32_t clock_ = 0;
+    ViewManagerStats stats_{};
+};
+
+}  // namespace oc::ui::lvgl
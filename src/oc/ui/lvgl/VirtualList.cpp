@@ -0,0 +1,122 @@
+#include "VirtualList.hpp"
+
+#include <algorithm>
+
+#include "StaticSurfaceInvalidation.hpp"
+
+namespace oc::ui::lvgl {
+
+VirtualList::VirtualList(lv_obj_t* parent, const VirtualListConfig& config, ItemFactory factory, BindFn bind)
+    : config_(config), bind_(std::move(bind)) {
+    config_.visibleRows = static_cast<uint8_t>(std::min<size_t>(config_.visibleRows, MAX_POOL));
+    container_ = lv_obj_create(parent);
+    if (!container_) return;
+    lv_obj_remove_style_all(container_);
+    lv_obj_remove_flag(container_, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(container_, LV_PCT(100), config_.visibleRows * config_.itemHeight);
+
+    for (size_t i = 0; i < config_.visibleRows && factory; ++i) {
+        auto item = factory(container_);
+        if (!item || !item->getElement()) break;
+        lv_obj_add_flag(item->getElement(), LV_OBJ_FLAG_IGNORE_LAYOUT);
+        item->hide();
+        pool_[pool_size_++].item = std::move(item);
+    }
+}
+
+VirtualList::~VirtualList() {
+    // Items delete their own LVGL objects; the container goes last.
+    for (auto& slot : pool_) slot.item.reset();
+    if (container_) lv_obj_delete(container_);
+    container_ = nullptr;
+}
+
+void VirtualList::setCount(size_t count) {
+    count_ = count;
+    if (selected_ != NO_SELECTION && selected_ >= count_) selected_ = NO_SELECTION;
+    first_ = std::min(first_, count_ > rows() ? count_ - rows() : 0);
+    place(true);
+}
+
+void VirtualList::setSelected(size_t index) {
+    if (index != NO_SELECTION && index >= count_) return;
+    if (index == selected_) return;
+
+    const size_t previous = selected_;
+    selected_ = index;
+    if (previous != NO_SELECTION && isVisible(previous)) setHighlight(slotFor(previous), false);
+    if (index == NO_SELECTION) return;
+
+    if (index < first_) {
+        scrollTo(index);
+    } else if (index >= first_ + rows()) {
+        scrollTo(index + 1 - rows());
+    }
+    if (isVisible(index)) setHighlight(slotFor(index), true);
+}
+
+void VirtualList::scrollTo(size_t first) {
+    first = std::min(first, count_ > rows() ? count_ - rows() : 0);
+    if (first == first_) return;
+
+    first_ = first;
+    ++stats_.scrolls;
+    place(false);
+}
+
+void VirtualList::refreshItem(size_t index) {
+    if (isVisible(index)) bind(slotFor(index), index);
+}
+
+void VirtualList::refresh() {
+    place(true);
+}
+
+bool VirtualList::isVisible(size_t index) const {
+    return pool_size_ > 0 && index < count_ && index >= first_ && index < first_ + rows();
+}
+
+void VirtualList::place(bool rebindAll) {
+    if (pool_size_ == 0) return;
+
+    // Bind first: bind_ is user code and must not run inside the batch.
+    for (size_t row = first_; row < first_ + rows() && row < count_; ++row) {
+        Slot& slot = slotFor(row);
+        if (rebindAll || slot.row != row) bind(slot, row);
+    }
+
+    // One invalidation of the list instead of two per moved row.
+    StaticSurfaceInvalidationBatch<1> batch(container_, config_.staticSurface);
+    batch.include(container_);
+
+    for (size_t offset = 0; offset < rows(); ++offset) {
+        const size_t row = first_ + offset;
+        Slot& slot = slotFor(row);
+        lv_obj_t* element = slot.item->getElement();
+
+        if (row >= count_) {
+            if (slot.item->isVisible()) slot.item->hide();
+            slot.row = NO_SELECTION;
+            continue;
+        }
+
+        lv_obj_set_pos(element, 0, static_cast<int32_t>(offset) * config_.itemHeight);
+        if (!slot.item->isVisible()) slot.item->show();
+    }
+}
+
+void VirtualList::bind(Slot& slot, size_t index) {
+    slot.row = index;
+    if (bind_) bind_(*slot.item, index);
+    ++stats_.binds;
+    setHighlight(slot, index == selected_);
+}
+
+void VirtualList::setHighlight(Slot& slot, bool highlighted) {
+    if (slot.highlighted == highlighted) return;
+    slot.highlighted = highlighted;
+    slot.item->setHighlighted(highlighted);
+    ++stats_.highlightChanges;
+}
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include <lvgl.h>
+
+#include "IListItem.hpp"
+#include "IWidget.hpp"
+
+namespace oc::ui::lvgl {
+
+/**
+ * @brief Geometry and invalidation options of a VirtualList
+ */
+struct VirtualListConfig {
+    uint8_t visibleRows = 8;       ///< Rows shown at once (pool size, clamped to MAX_POOL)
+    int32_t itemHeight = 32;       ///< Row pitch in pixels
+    bool staticSurface = false;    ///< Invalidate moved rows through a static-surface batch
+};
+
+struct VirtualListStats {
+    uint32_t binds = 0;             ///< Items bound to a data index
+    uint32_t highlightChanges = 0;  ///< setHighlighted() calls
+    uint32_t scrolls = 0;           ///< Window moves
+};
+
+/**
+ * @brief Windowed list over a data source of any size
+ *
+ * Only visibleRows IListItems exist. Rows live in a ring: item slot
+ * (index % visibleRows) shows data row index, so scrolling by n rows binds
+ * only the n rows entering the window and moves the others. Moving the
+ * selection touches the two affected items only.
+ *
+ * With staticSurface, the list container must meet the static-surface
+ * contract: a scroll then invalidates the list once instead of per row.
+ * Rows are bound before the batch opens; only their moves and visibility
+ * changes happen inside it.
+ *
+ * @code
+ * VirtualList tracks(parent, {.visibleRows = 6, .itemHeight = 40},
+ *     [](lv_obj_t* p) { return std::make_unique<TrackItem>(p); },
+ *     [this](IListItem& item, size_t i) { static_cast<TrackItem&>(item).render(tracks_[i]); });
+ * tracks.setCount(tracks_.size());
+ * tracks.setSelected(current);
+ * @endcode
+ */
+class VirtualList : public IWidget {
+public:
+    static constexpr size_t MAX_POOL = 16;
+    static constexpr size_t NO_SELECTION = SIZE_MAX;
+
+    using ItemFactory = std::function<std::unique_ptr<IListItem>(lv_obj_t* parent)>;
+    using BindFn = std::function<void(IListItem& item, size_t index)>;
+
+    VirtualList(lv_obj_t* parent, const VirtualListConfig& config, ItemFactory factory, BindFn bind);
+    ~VirtualList() override;
+
+    VirtualList(const VirtualList&) = delete;
+    VirtualList& operator=(const VirtualList&) = delete;
+    VirtualList(VirtualList&&) = delete;
+    VirtualList& operator=(VirtualList&&) = delete;
+
+    lv_obj_t* getElement() const override { return container_; }
+
+    /** Sets the number of data rows; visible rows are rebound. */
+    void setCount(size_t count);
+    [[nodiscard]] size_t count() const { return count_; }
+
+    /** Moves the highlight, scrolling the minimum needed to keep it visible. */
+    void setSelected(size_t index);
+    [[nodiscard]] size_t selected() const { return selected_; }
+
+    /** Makes first the top visible row (clamped to the data). */
+    void scrollTo(size_t first);
+    [[nodiscard]] size_t firstVisible() const { return first_; }
+
+    /** Rebinds one row if visible (its data changed). */
+    void refreshItem(size_t index);
+
+    /** Rebinds every visible row. */
+    void refresh();
+
+    [[nodiscard]] const VirtualListStats& stats() const { return stats_; }
+
+private:
+    struct Slot {
+        std::unique_ptr<IListItem> item;
+        size_t row = NO_SELECTION;  ///< Bound data row, NO_SELECTION when unbound
+        bool highlighted = false;
+    };
+
+    [[nodiscard]] size_t rows() const { return pool_size_; }
+    [[nodiscard]] bool isVisible(size_t index) const;
+    Slot& slotFor(size_t index) { return pool_[index % pool_size_]; }
+    void place(bool rebindAll);
+    void bind(Slot& slot, size_t index);
+    void setHighlight(Slot& slot, bool highlighted);
+
+    lv_obj_t* container_ = nullptr;
+    VirtualListConfig config_;
+    BindFn bind_;
+    std::array<Slot, MAX_POOL> pool_{};
+    size_t pool_size_ = 0;
+    size_t count_ = 0;
+    size_t first_ = 0;
+    size_t selected_ = NO_SELECTION;
+    VirtualListStats stats_{};
+};
+
+}  // namespace oc::ui::lvgl
@@ -0,0 +1,105 @@
+#include "VisibilityEpoch.hpp"
+
+#include <array>
+
+namespace oc::ui::lvgl {
+
+namespace {
+
+std::array<VisibilitySlot, MAX_VISIBILITY_SLOTS> g_slots{};
+uint32_t g_bumps = 0;
+uint32_t g_refreshes = 0;
+
+void onObjectDeleted(lv_event_t* e) {
+    auto* slot = static_cast<VisibilitySlot*>(lv_event_get_user_data(e));
+    if (slot) slot->object = nullptr;
+}
+
+}  // namespace
+
+bool isObjectActive(const lv_obj_t* obj) {
+    if (!obj) return false;
+
+    const lv_obj_t* top = obj;
+    for (const lv_obj_t* o = obj; o; o = lv_obj_get_parent(o)) {
+        if (lv_obj_has_flag(o, LV_OBJ_FLAG_HIDDEN)) return false;
+        top = o;
+    }
+    return detail::isShownRoot(lv_obj_get_display(top), top);
+}
+
+void bumpVisibilityEpoch() {
+    // 0 is never current, so fresh slots always refresh once.
+    if (++detail::visibilityEpoch == 0) detail::visibilityEpoch = 1;
+    ++g_bumps;
+}
+
+void setObjectHidden(lv_obj_t* obj, bool hidden) {
+    if (!obj || lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) == hidden) return;
+    if (hidden) {
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_remove_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    }
+    bumpVisibilityEpoch();
+}
+
+void setObjectParent(lv_obj_t* obj, lv_obj_t* parent) {
+    if (!obj || !parent || lv_obj_get_parent(obj) == parent) return;
+    lv_obj_set_parent(obj, parent);
+    bumpVisibilityEpoch();
+}
+
+VisibilityCacheStats visibilityCacheStats() {
+    VisibilityCacheStats stats{};
+    stats.epoch = detail::visibilityEpoch;
+    stats.bumps = g_bumps;
+    stats.hits = detail::visibilityHits;
+    stats.refreshes = g_refreshes;
+    for (const auto& slot : g_slots) {
+        if (slot.object) ++stats.tracked;
+    }
+    return stats;
+}
+
+VisibilityHandle watchVisibility(lv_obj_t* obj) {
+    if (!obj) return {};
+
+    VisibilitySlot* free = nullptr;
+    for (auto& slot : g_slots) {
+        if (slot.object == obj) return {&slot, slot.generation};
+        if (!free && !slot.object) free = &slot;
+    }
+    if (!free) return {};
+
+    // A new generation orphans handles to the slot's previous, deleted object.
+    free->object = obj;
+    free->root = nullptr;
+    free->display = nullptr;
+    free->epoch = 0;
+    free->ancestorsShown = false;
+    ++free->generation;
+    lv_obj_add_event_cb(obj, onObjectDeleted, LV_EVENT_DELETE, free);
+    return {free, free->generation};
+}
+
+namespace detail {
+
+bool refreshVisibility(VisibilitySlot& slot) {
+    ++g_refreshes;
+    lv_obj_t* root = slot.object;
+    slot.ancestorsShown = true;
+    for (lv_obj_t* o = lv_obj_get_parent(slot.object); o; o = lv_obj_get_parent(o)) {
+        if (lv_obj_has_flag(o, LV_OBJ_FLAG_HIDDEN)) slot.ancestorsShown = false;
+        root = o;
+    }
+    slot.root = root;
+    slot.display = lv_obj_get_display(root);
+    slot.epoch = visibilityEpoch;
+    return slot.ancestorsShown && !lv_obj_has_flag(slot.object, LV_OBJ_FLAG_HIDDEN)
+           && isShownRoot(slot.display, root);
+}
+
+}  // namespace detail
+
+}  // namespace oc::ui::lvgl
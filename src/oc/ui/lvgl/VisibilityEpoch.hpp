@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <lvgl.h>
+
+namespace oc::ui::lvgl {
+
+struct VisibilityCacheStats {
+    uint32_t epoch = 0;
+    uint32_t bumps = 0;       ///< Epoch increments (visibility may have changed)
+    uint32_t hits = 0;        ///< Checks answered from the cached ancestors
+    uint32_t refreshes = 0;   ///< Checks that walked the object's ancestors
+    uint16_t tracked = 0;     ///< Live objects with a slot
+};
+
+/// Objects whose activity can be cached at once; see watchVisibility().
+inline constexpr size_t MAX_VISIBILITY_SLOTS = 128;
+
+/**
+ * @brief Whether obj is shown: no hidden ancestor and rooted in the active
+ * screen or a display layer
+ *
+ * Trees parked in a RetainedSurfaceParkingLot (or on any other inactive
+ * screen) are not active. Walks the parent chain on every call.
+ */
+bool isObjectActive(const lv_obj_t* obj);
+
+/**
+ * @brief Mark every cached activity result stale
+ *
+ * Called by setObjectHidden(), setObjectParent() and so by parking-lot
+ * attach/park. Call it after hiding or showing an ancestor of a watched
+ * object, or reparenting one, through LVGL directly.
+ */
+void bumpVisibilityEpoch();
+
+/** Hides or shows obj, bumping the epoch when the flag changes. */
+void setObjectHidden(lv_obj_t* obj, bool hidden);
+
+/** Moves obj under parent, bumping the epoch when the parent changes. */
+void setObjectParent(lv_obj_t* obj, lv_obj_t* parent);
+
+[[nodiscard]] VisibilityCacheStats visibilityCacheStats();
+
+struct VisibilitySlot {
+    lv_obj_t* object = nullptr;    ///< nullptr once deleted
+    lv_obj_t* root = nullptr;      ///< Topmost ancestor at the last refresh
+    lv_display_t* display = nullptr;
+    uint32_t epoch = 0;
+    uint16_t generation = 0;
+    bool ancestorsShown = false;   ///< No hidden ancestor at the last refresh
+};
+
+namespace detail {
+inline uint32_t visibilityEpoch = 1;
+inline uint32_t visibilityHits = 0;
+
+bool refreshVisibility(VisibilitySlot& slot);
+
+/** Whether root is the display's active screen or one of its layers. */
+inline bool isShownRoot(lv_display_t* display, const lv_obj_t* root) {
+    return display
+           && (root == lv_display_get_screen_active(display) || root == lv_display_get_layer_top(display)
+               || root == lv_display_get_layer_sys(display) || root == lv_display_get_layer_bottom(display));
+}
+}  // namespace detail
+
+/**
+ * @brief Cached activity check for one object
+ *
+ * Two words, so an IsActiveFn wrapping it fits std::function's inline
+ * storage. Within an epoch a check reads the object's own hidden flag and
+ * compares its cached root with the active screen, so hiding the object
+ * itself and loading screens need no bump. A stale epoch walks the ancestors
+ * once. Reports false once the object is deleted.
+ */
+class VisibilityHandle {
+public:
+    VisibilityHandle() = default;
+    VisibilityHandle(VisibilitySlot* slot, uint16_t generation) : slot_(slot), generation_(generation) {}
+
+    bool operator()() const {
+        if (!slot_ || slot_->generation != generation_ || !slot_->object) return false;
+        if (slot_->epoch == detail::visibilityEpoch) {
+            ++detail::visibilityHits;
+            return slot_->ancestorsShown && !lv_obj_has_flag(slot_->object, LV_OBJ_FLAG_HIDDEN)
+                   && detail::isShownRoot(slot_->display, slot_->root);
+        }
+        return detail::refreshVisibility(*slot_);
+    }
+
+    [[nodiscard]] bool valid() const { return slot_ != nullptr; }
+
+private:
+    VisibilitySlot* slot_ = nullptr;
+    uint16_t generation_ = 0;
+};
+
+/**
+ * @brief Cached activity check for obj, sharing its slot with earlier handles
+ *
+ * The slot is released when obj is deleted. Returns an invalid handle when
+ * all MAX_VISIBILITY_SLOTS slots hold live objects.
+ */
+VisibilityHandle watchVisibility(lv_obj_t* obj);
+
+}  // namespace oc::ui::lvgl